@@ -0,0 +1,76 @@
+#ifndef TRAJECTORY_HELPER__BENCH__BENCH_HPP
+#define TRAJECTORY_HELPER__BENCH__BENCH_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace th {
+namespace bench {
+
+/**
+ * Minimal timing helpers for the benchmark programs in bench/ (std::chrono only).
+ *
+ * Every measurement runs the function in batches until a batch takes at least min_seconds and
+ * reports the fastest of `repetitions` batches, which filters out scheduler noise. The
+ * benchmarks are meant for relative comparisons on one machine; absolute numbers depend on the
+ * compiler flags (build with -O3 and the target's -march to see vectorized code).
+ */
+
+// Keeps the compiler from discarding a computed value
+template<typename V>
+void do_not_optimize(const V& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+using clock = std::chrono::steady_clock;
+
+inline double seconds_since(clock::time_point start) {
+    return std::chrono::duration<double>(clock::now() - start).count();
+}
+
+/**
+ * Seconds per call of fn, the best of `repetitions` batches of at least min_seconds
+ */
+template<typename Fn>
+double seconds_per_call(Fn&& fn, double min_seconds = 0.1, int repetitions = 5) {
+    fn();  // warm up caches and allocators
+    double best = 1e300;
+    for (int r = 0; r < repetitions; ++r) {
+        size_t calls = 0;
+        const clock::time_point start = clock::now();
+        double elapsed = 0.0;
+        do {
+            fn();
+            ++calls;
+            elapsed = seconds_since(start);
+        } while (elapsed < min_seconds);
+        best = std::min(best, elapsed / static_cast<double>(calls));
+    }
+    return best;
+}
+
+// Short runs for smoke testing: set TRAJECTORY_HELPER_BENCH_QUICK=1
+inline double min_seconds() {
+    return std::getenv("TRAJECTORY_HELPER_BENCH_QUICK") ? 0.005 : 0.1;
+}
+
+inline void print_header(const char* title) {
+    std::printf("\n%s\n", title);
+}
+
+inline void print_row(const std::string& name, double seconds, double reference_seconds) {
+    std::printf("  %-44s %12.3f us %8.2fx\n", name.c_str(), seconds * 1e6, reference_seconds / seconds);
+}
+
+}  // namespace bench
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__BENCH__BENCH_HPP
@@ -0,0 +1,73 @@
+/**
+ * calculate() of closed 2D and 3D tracks for both math policies and float/double coordinates.
+ *
+ * The heading and curvature kernels only vectorize with the target's vector instructions
+ * enabled, so compare builds such as -O3 -march=x86-64-v3 against plain -O2. StdMath keeps a
+ * scalar std::atan2 unless the compiler has a vector math library for it (GCC with -ffast-math
+ * and glibc's libmvec); FastMath is plain arithmetic and vectorizes on its own. The speedup
+ * column is relative to StdMath on the same coordinate type.
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include <trajectory_helper/track/track.hpp>
+#include <trajectory_helper/track/track3.hpp>
+
+#include "bench.hpp"
+
+namespace {
+
+template<typename T>
+th::Point2<T> make_point(double x, double y, double, th::Point2<T>*) { return th::Point2<T>(T(x), T(y)); }
+
+template<typename T>
+th::Point3<T> make_point(double x, double y, double z, th::Point3<T>*) { return th::Point3<T>(T(x), T(y), T(z)); }
+
+// Closed loop with three lobes; the 3D track climbs and descends 5 m once per lap
+template<typename Point>
+std::vector<Point> make_points(size_t n) {
+    std::vector<Point> points;
+    points.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        double r = 100.0 * (1.0 + 0.2 * std::sin(3.0 * phi));
+        points.push_back(make_point(r * std::cos(phi), r * std::sin(phi), 5.0 * std::sin(phi), static_cast<Point*>(nullptr)));
+    }
+    return points;
+}
+
+template<typename Track, typename Math>
+double time_calculate(const Track& input) {
+    Track track = input;
+    return th::bench::seconds_per_call([&]() {
+        track.template calculate<Math>(true, 2.0, 2.0, 2.0, 2.0);
+        th::bench::do_not_optimize(track.back().kappa);
+    }, th::bench::min_seconds());
+}
+
+template<typename Track, typename Point>
+void run(const char* name, size_t n) {
+    const Track track(make_points<Point>(n));
+    const double std_math = time_calculate<Track, th::StdMath>(track);
+    const double fast_math = time_calculate<Track, th::FastMath>(track);
+    th::bench::print_row(std::string(name) + " StdMath", std_math, std_math);
+    th::bench::print_row(std::string(name) + " FastMath", fast_math, std_math);
+}
+
+}  // namespace
+
+int main() {
+    for (size_t n : {1000, 10000, 100000}) {
+        char title[64];
+        std::snprintf(title, sizeof(title), "calculate(), %zu point closed track", n);
+        th::bench::print_header(title);
+        run<th::Track2d, th::Point2d>("Track2d", n);
+        run<th::Track2f, th::Point2f>("Track2f", n);
+        run<th::Track3d, th::Point3d>("Track3d", n);
+    }
+    return 0;
+}
@@ -0,0 +1,136 @@
+/**
+ * Planner cycle throughput with the global heap vs. a per-thread monotonic arena, for an
+ * increasing number of threads (user-facing scenario of th::pmr::Track2).
+ *
+ * Every thread runs the same cycle in a loop: build a track from raw points, calculate it,
+ * read two columns, interpolate a batch of stations, resample it and project a few points with
+ * a warm start. The arena variant allocates everything from a thread-local buffer that is
+ * released at the end of each cycle, so the threads never touch the shared heap.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+#include <trajectory_helper/track/track.hpp>
+
+#include "bench.hpp"
+
+namespace {
+
+struct Input {
+    std::vector<th::Point2d> points;
+    std::vector<double> queries;
+    std::vector<th::Point2d> positions;
+};
+
+Input make_input(size_t n) {
+    Input input;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        double r = 100.0 * (1.0 + 0.2 * std::sin(3.0 * phi));
+        input.points.emplace_back(r * std::cos(phi), r * std::sin(phi));
+    }
+    for (size_t i = 0; i < 200; ++i) {
+        input.queries.push_back(3.0 * static_cast<double>(i));
+    }
+    for (size_t i = 0; i < 20; ++i) {
+        double phi = 0.05 * static_cast<double>(i);
+        input.positions.emplace_back(101.0 * std::cos(phi), 101.0 * std::sin(phi));
+    }
+    return input;
+}
+
+template<typename Track>
+double cycle(const Input& input, const typename Track::allocator_type& alloc) {
+    Track track(input.points, alloc);
+    track.calculate(true);
+    auto s = track.s();
+    auto kappa = track.kappa();
+    auto interpolated = track.interpolate(input.queries, true);
+    Track resampled = track.interpolate_track(0.5, true);
+
+    double sum = s.back() + kappa.front() + interpolated.back().x + resampled.back().s;
+    size_t hint = 0;
+    for (const auto& position : input.positions) {
+        auto projected = resampled.project(position, hint, 16, true);
+        hint = static_cast<size_t>(projected.s / 0.5);
+        sum += projected.s;
+    }
+    return sum;
+}
+
+struct HeapCycle {
+    const Input& input;
+    double operator()() {
+        return cycle<th::Track2d>(input, std::allocator<th::TrackPoint2d>());
+    }
+};
+
+struct ArenaCycle {
+    explicit ArenaCycle(const Input& input)
+    : input(input), buffer(1 << 20), arena(buffer.data(), buffer.size(), std::pmr::new_delete_resource()) {}
+
+    double operator()() {
+        double result = cycle<th::pmr::Track2d>(input, &arena);
+        arena.release();
+        return result;
+    }
+
+    const Input& input;
+    std::vector<std::byte> buffer;
+    std::pmr::monotonic_buffer_resource arena;
+};
+
+// Cycles per second of all threads together
+template<typename MakeCycle>
+double throughput(size_t n_threads, double seconds, MakeCycle make_cycle) {
+    std::atomic<bool> start{false};
+    std::atomic<bool> stop{false};
+    std::vector<size_t> cycles(n_threads, 0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < n_threads; ++t) {
+        threads.emplace_back([&, t]() {
+            auto run = make_cycle();
+            while (!start.load()) std::this_thread::yield();
+            size_t count = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                th::bench::do_not_optimize(run());
+                ++count;
+            }
+            cycles[t] = count;
+        });
+    }
+    const auto begin = th::bench::clock::now();
+    start.store(true);
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+    stop.store(true);
+    for (auto& thread : threads) thread.join();
+    const double elapsed = th::bench::seconds_since(begin);
+
+    size_t total = 0;
+    for (size_t count : cycles) total += count;
+    return static_cast<double>(total) / elapsed;
+}
+
+}  // namespace
+
+int main() {
+    const Input input = make_input(2000);
+    const double seconds = 10 * th::bench::min_seconds();
+    const size_t max_threads = std::max<size_t>(4, std::thread::hardware_concurrency());
+
+    std::printf("Planner cycle throughput (2000 point track), cycles/s over all threads\n");
+    std::printf("  %8s %14s %14s %8s\n", "threads", "heap", "arena", "speedup");
+    for (size_t n_threads = 1; n_threads <= max_threads; n_threads *= 2) {
+        double heap = throughput(n_threads, seconds, [&]() { return HeapCycle{input}; });
+        double arena = throughput(n_threads, seconds, [&]() { return ArenaCycle(input); });
+        std::printf("  %8zu %14.0f %14.0f %7.2fx\n", n_threads, heap, arena, arena / heap);
+    }
+    return 0;
+}
@@ -0,0 +1,103 @@
+/**
+ * k-nearest and radius queries on track points: TrackPointIndex2 (grid index) against the
+ * brute force find_k_nearest_idx / find_within_radius_idx, for growing tracks.
+ *
+ * The queries lie near the track, as for a vehicle looking up nearby track points; the
+ * speedup column is relative to the brute force query on the same track.
+ */
+
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <trajectory_helper/track/track.hpp>
+#include <trajectory_helper/track/track_point_index.hpp>
+
+#include "bench.hpp"
+
+namespace {
+
+// Closed loop with three lobes, about 1 m between points
+th::Track2d make_track(size_t n) {
+    const double radius = static_cast<double>(n) / (2.0 * M_PI);
+    std::vector<th::Point2d> points;
+    points.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        double r = radius * (1.0 + 0.2 * std::sin(3.0 * phi));
+        points.emplace_back(r * std::cos(phi), r * std::sin(phi));
+    }
+    return th::Track2d(points);
+}
+
+// Query points spread along the track, offset 2 m sideways
+std::vector<th::Point2d> make_queries(const th::Track2d& track, size_t n_queries) {
+    std::vector<th::Point2d> queries;
+    for (size_t q = 0; q < n_queries; ++q) {
+        const auto& p1 = track[q * track.size() / n_queries];
+        const auto& p2 = track[(q * track.size() / n_queries + 1) % track.size()];
+        const double dx = p2.x - p1.x;
+        const double dy = p2.y - p1.y;
+        const double length = std::hypot(dx, dy);
+        queries.emplace_back(p1.x - 2.0 * dy / length, p1.y + 2.0 * dx / length);
+    }
+    return queries;
+}
+
+}  // namespace
+
+int main() {
+    constexpr size_t k = 8;
+    constexpr double radius = 5.0;
+    constexpr size_t n_queries = 64;
+
+    for (size_t n : {1000, 10000, 100000}) {
+        const th::Track2d track = make_track(n);
+        const std::vector<th::Point2d> queries = make_queries(track, n_queries);
+        const th::TrackPointIndex2d index(track);
+        std::vector<size_t> found;
+        found.reserve(n);
+
+        char title[96];
+        std::snprintf(title, sizeof(title), "%zu point track, %zu queries per call", n, n_queries);
+        th::bench::print_header(title);
+
+        const double brute_k = th::bench::seconds_per_call([&]() {
+            found.clear();
+            for (const auto& q : queries) {
+                th::find_k_nearest_idx(track.begin(), track.end(), q, k, std::back_inserter(found));
+            }
+            th::bench::do_not_optimize(found.back());
+        }, th::bench::min_seconds());
+        const double indexed_k = th::bench::seconds_per_call([&]() {
+            found.clear();
+            for (const auto& q : queries) {
+                index.k_nearest(q, k, std::back_inserter(found));
+            }
+            th::bench::do_not_optimize(found.back());
+        }, th::bench::min_seconds());
+        th::bench::print_row("k_nearest (k = 8) brute force", brute_k, brute_k);
+        th::bench::print_row("k_nearest (k = 8) TrackPointIndex2", indexed_k, brute_k);
+
+        const double brute_r = th::bench::seconds_per_call([&]() {
+            found.clear();
+            for (const auto& q : queries) {
+                th::find_within_radius_idx(track.begin(), track.end(), q, radius, std::back_inserter(found));
+            }
+            th::bench::do_not_optimize(found.back());
+        }, th::bench::min_seconds());
+        const double indexed_r = th::bench::seconds_per_call([&]() {
+            found.clear();
+            for (const auto& q : queries) {
+                index.within_radius(q, radius, std::back_inserter(found));
+            }
+            th::bench::do_not_optimize(found.back());
+        }, th::bench::min_seconds());
+        th::bench::print_row("within_radius (5 m) brute force", brute_r, brute_r);
+        th::bench::print_row("within_radius (5 m) TrackPointIndex2", indexed_r, brute_r);
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+/**
+ * libFuzzer entry point running the track fast paths against the reference implementations
+ * (test/reference/track_reference.hpp). Any disagreement aborts.
+ *
+ * Build with Clang and run locally:
+ *   cmake -S . -B build -DCMAKE_CXX_COMPILER=clang++ -DBUILD_FUZZERS=ON
+ *   cmake --build build --target track_fuzzer
+ *   ./build/track_fuzzer -max_len=2049
+ *
+ * Input layout: one flag byte (bit 0: closed, bits 1-3: stepsize), then 4 bytes per point
+ * (x and y as little endian int16 in centimeters). Coordinates on a centimeter grid produce
+ * plenty of duplicate points, collinear runs and exact ties.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+#include <trajectory_helper/track/track.hpp>
+#include <trajectory_helper/track/track_interpolator.hpp>
+#include <trajectory_helper/track/track_point_index.hpp>
+#include <trajectory_helper/track/track_projector.hpp>
+
+#include "reference/track_reference.hpp"
+
+namespace {
+
+constexpr size_t kMaxPoints = 512;
+constexpr double kTol = 1e-9;
+constexpr double kKappaTol = 1e-6;
+
+void check(bool ok, const char* what) {
+    if (!ok) {
+        std::fprintf(stderr, "Mismatch against the reference: %s\n", what);
+        std::abort();
+    }
+}
+
+double coordinate(const uint8_t* data) {
+    return static_cast<double>(static_cast<int16_t>(data[0] | (data[1] << 8))) * 0.01;
+}
+
+}  // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    if (size < 1 + 2 * 4) {
+        return 0;
+    }
+    const bool closed = (data[0] & 1) != 0;
+    static const double stepsizes[] = {0.0, 0.5, 1.0, 2.5, 10.0, 1e3, 1e12, std::numeric_limits<double>::infinity()};
+    const double stepsize = stepsizes[(data[0] >> 1) & 7];
+
+    std::vector<th::TrackPoint2d> points;
+    for (size_t i = 1; i + 4 <= size && points.size() < kMaxPoints; i += 4) {
+        points.emplace_back(coordinate(data + i), coordinate(data + i + 2), 1.0, 1.0);
+    }
+
+    // calculate
+    auto expected = points;
+    th::reference::calculate(expected, closed, stepsize, stepsize, stepsize, stepsize);
+    th::Track2d track(points);
+    track.calculate(closed, stepsize, stepsize, stepsize, stepsize);
+    for (size_t i = 0; i < points.size(); ++i) {
+        check(th::reference::points_near(track[i], expected[i], kTol, kKappaTol), "calculate");
+    }
+
+    // interpolate, between stations so that duplicate points cannot tie
+    const double lap = closed ? th::track_length(track.begin(), track.end(), true) : 0.0;
+    std::vector<double> queries;
+    for (size_t i = 0; i + 1 < track.size(); ++i) {
+        if (track[i + 1].s > track[i].s) {
+            queries.push_back(0.5 * (track[i].s + track[i + 1].s));
+        }
+    }
+    for (double s : queries) {
+        check(th::reference::points_near(track.interpolate(s, closed), th::reference::interpolate(expected, s, closed), kTol, kKappaTol, lap), "interpolate");
+    }
+    if (track.has_kappa()) {
+        th::TrackInterpolator2d interpolator(track, closed, th::InterpolationMode::Linear);
+        for (double s : queries) {
+            check(th::reference::points_near(interpolator.interpolate(s), th::reference::interpolate(expected, s, closed), kTol, kKappaTol, lap), "TrackInterpolator2");
+        }
+    }
+
+    // project, and nearest points of the segment midpoints shifted sideways
+    th::TrackProjector2d projector(track, closed);
+    th::TrackPointIndex2d index(track);
+    th::TrackProjector2d::Context ctx;
+    for (size_t i = 0; i < track.size(); ++i) {
+        const auto& p1 = track[i];
+        const auto& p2 = track[(i + 1) % track.size()];
+        th::Point2d q(0.5 * (p1.x + p2.x) + 0.37 * (p2.y - p1.y), 0.5 * (p1.y + p2.y) - 0.37 * (p2.x - p1.x));
+
+        auto reference = th::reference::project(expected, q, closed);
+        check(th::reference::points_near(track.project(q, closed), reference, kTol, kKappaTol, lap), "project");
+        check(th::reference::points_near(projector.project(q), reference, kTol, kKappaTol, lap), "TrackProjector2");
+        check(th::reference::points_near(projector.project(q, ctx), reference, kTol, kKappaTol, lap), "TrackProjector2 context");
+
+        check(index.k_nearest(q, 4) == th::reference::k_nearest(expected, q, 4), "TrackPointIndex2::k_nearest");
+        check(index.within_radius(q, 1.0) == th::reference::within_radius(expected, q, 1.0), "TrackPointIndex2::within_radius");
+    }
+    return 0;
+}
@@ -0,0 +1,282 @@
+#ifndef TRAJECTORY_HELPER__FRENET__FRENET_SAMPLER_HPP
+#define TRAJECTORY_HELPER__FRENET__FRENET_SAMPLER_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "trajectory_helper/utils.hpp"
+#include "trajectory_helper/instrumentation.hpp"
+#include "trajectory_helper/track/track.hpp"
+#include "trajectory_helper/track/track_algorithm.hpp"
+#include "trajectory_helper/track/track_batch.hpp"
+
+namespace th {
+
+/**
+ * State in the Frenet frame of a reference track: station s and lateral offset d (left
+ * positive) with their first and second time derivatives
+ */
+template<typename T>
+struct FrenetState {
+    T s = T();
+    T s_d = T();
+    T s_dd = T();
+    T d = T();
+    T d_d = T();
+    T d_dd = T();
+};
+
+/**
+ * End state of a candidate reached after duration
+ */
+template<typename T>
+struct FrenetCandidate {
+    FrenetState<T> end;
+    T duration = T(1);
+};
+
+/**
+ * Quintic polynomial x(t) = c0 + c1 t + ... + c5 t^5 matching position, velocity and
+ * acceleration at t = 0 and t = duration
+ */
+template<typename T>
+struct QuinticPolynomial {
+    T c[6] = {};
+
+    QuinticPolynomial() = default;
+
+    QuinticPolynomial(T x0, T v0, T a0, T x1, T v1, T a1, T duration) {
+        if (!(duration > T(0))) {
+            throw std::runtime_error("Polynomial duration must be positive.");
+        }
+        const T t = duration;
+        const T t2 = t * t;
+        c[0] = x0;
+        c[1] = v0;
+        c[2] = T(0.5) * a0;
+        const T b0 = x1 - c[0] - c[1] * t - c[2] * t2;
+        const T b1 = v1 - c[1] - T(2) * c[2] * t;
+        const T b2 = a1 - T(2) * c[2];
+        c[3] = (T(10) * b0 - T(4) * b1 * t + T(0.5) * b2 * t2) / (t2 * t);
+        c[4] = (T(-15) * b0 + T(7) * b1 * t - b2 * t2) / (t2 * t2);
+        c[5] = (T(6) * b0 - T(3) * b1 * t + T(0.5) * b2 * t2) / (t2 * t2 * t);
+    }
+
+    T operator()(T t) const {
+        return c[0] + t * (c[1] + t * (c[2] + t * (c[3] + t * (c[4] + t * c[5]))));
+    }
+    T derivative(T t) const {
+        return c[1] + t * (T(2) * c[2] + t * (T(3) * c[3] + t * (T(4) * c[4] + t * T(5) * c[5])));
+    }
+    T second_derivative(T t) const {
+        return T(2) * c[2] + t * (T(6) * c[3] + t * (T(12) * c[4] + t * T(20) * c[5]));
+    }
+};
+
+/**
+ * Frenet lattice sampler over a reference track.
+ *
+ * The reference geometry (s, x, y, psi, kappa, widths) is cached once as structure of arrays,
+ * e.g. once per planning cycle. sample() fits a longitudinal and a lateral quintic from the
+ * start state to every candidate end state, evaluates both at n_samples equidistant times
+ * into contiguous buffers and maps the samples to Cartesian points in bulk. Each candidate
+ * becomes one track of a TrackBatch2 whose s is the Cartesian path length and whose wl/wr are
+ * the reference widths shifted by the lateral offset. Candidates are processed in parallel
+ * when OpenMP is enabled (see TrackBatch2). The polynomial evaluation loops vectorize over
+ * samples; the mapping to Cartesian points calls atan2/sin/cos per sample and stays scalar.
+ */
+template<typename T>
+class FrenetSampler2 {
+public:
+    template<typename Allocator>
+    explicit FrenetSampler2(const Track2<T, Allocator>& reference, bool is_closed = true) {
+        update(reference, is_closed);
+    }
+
+    /**
+     * Re-caches the reference geometry
+     */
+    template<typename Allocator>
+    void update(const Track2<T, Allocator>& reference, bool is_closed = true) {
+        if (reference.size() < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+        if (!reference.has_s() || !reference.has_psi() || !reference.has_kappa()) {
+            throw std::runtime_error("Track must have s, psi and kappa values! Call calculate() first.");
+        }
+
+        is_closed_ = is_closed;
+        has_widths_ = reference.has_widths();
+        const size_t n = reference.size() + (is_closed ? 1 : 0);
+        for (auto* column : {&s_, &x_, &y_, &psi_, &kappa_, &wl_, &wr_}) {
+            column->resize(n);
+        }
+        for (size_t i = 0; i < n; ++i) {
+            const auto& p = reference[i % reference.size()];
+            s_[i] = p.s;
+            x_[i] = p.x;
+            y_[i] = p.y;
+            psi_[i] = p.psi;
+            kappa_[i] = p.kappa;
+            wl_[i] = p.wl;
+            wr_[i] = p.wr;
+        }
+        // The closing segment ends at the front point one lap later
+        if (is_closed) {
+            s_[n - 1] = track_length(reference.begin(), reference.end(), true);
+        }
+    }
+
+    /**
+     * Samples every candidate from start at n_samples times in [0, duration] into out
+     * (cleared first, capacity reused)
+     */
+    template<typename InputIt>
+    void sample(const FrenetState<T>& start, InputIt first, InputIt last, size_t n_samples, TrackBatch2<T>& out) {
+        if (n_samples < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+        if (n_samples > static_cast<size_t>(std::numeric_limits<std::int32_t>::max())) {
+            throw std::runtime_error("Too many samples per candidate.");
+        }
+        candidates_.assign(first, last);
+        const size_t n_candidates = candidates_.size();
+        TH_INSTRUMENT(FrenetSample, n_candidates * n_samples);
+
+        out.clear();
+        out.reserve(n_candidates, n_candidates * n_samples);
+        for (size_t c = 0; c < n_candidates; ++c) {
+            out.add_track(n_samples);
+        }
+        for (auto* column : {&fs_, &fs_d_, &fs_dd_, &fd_, &fd_d_, &fd_dd_}) {
+            column->resize(n_candidates * n_samples);
+        }
+
+        detail::for_each_track(n_candidates, [&](size_t c) {
+            evaluate(start, candidates_[c], n_samples, c * n_samples);
+            to_cartesian(c * n_samples, n_samples, out.begin(c));
+        });
+    }
+
+    /**
+     * Frenet samples of the last sample() call; sample k of candidate c is at c * n_samples + k
+     */
+    const std::vector<T>& sampled_s() const { return fs_; }
+    const std::vector<T>& sampled_s_d() const { return fs_d_; }
+    const std::vector<T>& sampled_d() const { return fd_; }
+    const std::vector<T>& sampled_d_d() const { return fd_d_; }
+
+private:
+    // Evaluates both polynomials of a candidate at all sample times into the SoA buffers
+    void evaluate(const FrenetState<T>& start, const FrenetCandidate<T>& candidate, size_t n_samples, size_t offset) {
+        const FrenetState<T>& end = candidate.end;
+        const QuinticPolynomial<T> lon(start.s, start.s_d, start.s_dd, end.s, end.s_d, end.s_dd, candidate.duration);
+        const QuinticPolynomial<T> lat(start.d, start.d_d, start.d_dd, end.d, end.d_d, end.d_dd, candidate.duration);
+        const T dt = candidate.duration / static_cast<T>(n_samples - 1);
+
+        T* s = fs_.data() + offset;
+        T* s_d = fs_d_.data() + offset;
+        T* s_dd = fs_dd_.data() + offset;
+        T* d = fd_.data() + offset;
+        T* d_d = fd_d_.data() + offset;
+        T* d_dd = fd_dd_.data() + offset;
+        // One loop per polynomial, since GCC does not version a loop writing six columns for
+        // aliasing, and a 32 bit index, since converting a size_t to T does not vectorize
+        const std::int32_t n = static_cast<std::int32_t>(n_samples);
+        for (std::int32_t k = 0; k < n; ++k) {
+            const T t = static_cast<T>(k) * dt;
+            s[k] = lon(t);
+            s_d[k] = lon.derivative(t);
+            s_dd[k] = lon.second_derivative(t);
+        }
+        for (std::int32_t k = 0; k < n; ++k) {
+            const T t = static_cast<T>(k) * dt;
+            d[k] = lat(t);
+            d_d[k] = lat.derivative(t);
+            d_dd[k] = lat.second_derivative(t);
+        }
+    }
+
+    // Maps Frenet samples to Cartesian track points along the cached reference
+    void to_cartesian(size_t offset, size_t n_samples, TrackPoint2<T>* out) const {
+        const T s_min = s_.front();
+        const T length = s_.back() - s_min;
+        size_t idx = 0;
+
+        for (size_t k = 0; k < n_samples; ++k) {
+            T s = fs_[offset + k];
+            s = is_closed_ ? wrap_s(s, s_min, length) : std::clamp(s, s_min, s_.back());
+            idx = segment_index(s, idx);
+
+            // Reference point at s
+            const T ds = s_[idx + 1] - s_[idx];
+            const T alpha = ds > T(0) ? (s - s_[idx]) / ds : T(0);
+            const T x_r = x_[idx] + alpha * (x_[idx + 1] - x_[idx]);
+            const T y_r = y_[idx] + alpha * (y_[idx + 1] - y_[idx]);
+            const T psi_r = psi_[idx] + alpha * angle_diff(psi_[idx + 1], psi_[idx]);
+            const T kappa_r = kappa_[idx] + alpha * (kappa_[idx + 1] - kappa_[idx]);
+            const T dkappa_r = ds > T(0) ? (kappa_[idx + 1] - kappa_[idx]) / ds : T(0);
+
+            // Derivatives of d with respect to s
+            const T s_d = fs_d_[offset + k];
+            const T d = fd_[offset + k];
+            T d_p = T(0);
+            T d_pp = T(0);
+            if (std::abs(s_d) > T(1e-6)) {
+                d_p = fd_d_[offset + k] / s_d;
+                d_pp = (fd_dd_[offset + k] - d_p * fs_dd_[offset + k]) / (s_d * s_d);
+            }
+
+            const T one_minus_kd = T(1) - kappa_r * d;
+            const T delta_psi = std::atan2(d_p, one_minus_kd);
+            const T cos_dpsi = std::cos(delta_psi);
+            const T tan_dpsi = std::tan(delta_psi);
+
+            TrackPoint2<T>& p = out[k];
+            p.x = x_r - d * std::sin(psi_r);
+            p.y = y_r + d * std::cos(psi_r);
+            p.psi = normalize_psi(psi_r + delta_psi);
+            p.kappa = ((d_pp + (dkappa_r * d + kappa_r * d_p) * tan_dpsi) * cos_dpsi * cos_dpsi / one_minus_kd + kappa_r)
+                * cos_dpsi / one_minus_kd;
+            if (has_widths_) {
+                p.wl = wl_[idx] + alpha * (wl_[idx + 1] - wl_[idx]) - d;
+                p.wr = wr_[idx] + alpha * (wr_[idx + 1] - wr_[idx]) + d;
+            }
+            p.s = k == 0 ? T() : out[k - 1].s + distance(out[k - 1], p);
+        }
+    }
+
+    // Index of the cached segment containing s, advancing from hint for increasing s
+    size_t segment_index(T s, size_t hint) const {
+        const size_t last_segment = s_.size() - 2;
+        if (s < s_[hint]) {
+            size_t idx = static_cast<size_t>(std::distance(s_.begin(), std::upper_bound(s_.begin(), s_.end(), s)));
+            return std::min(idx > 0 ? idx - 1 : 0, last_segment);
+        }
+        while (hint < last_segment && s_[hint + 1] <= s) ++hint;
+        return hint;
+    }
+
+    bool is_closed_ = true;
+    bool has_widths_ = false;
+
+    // Cached reference geometry; closed tracks repeat the front point at the lap length
+    std::vector<T> s_, x_, y_, psi_, kappa_, wl_, wr_;
+
+    // Candidates and Frenet samples of the last sample() call
+    std::vector<FrenetCandidate<T>> candidates_;
+    std::vector<T> fs_, fs_d_, fs_dd_, fd_, fd_d_, fd_dd_;
+};
+
+typedef FrenetSampler2<float> FrenetSampler2f;
+typedef FrenetSampler2<double> FrenetSampler2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__FRENET__FRENET_SAMPLER_HPP
@@ -0,0 +1,192 @@
+#ifndef TRAJECTORY_HELPER__INSTRUMENTATION_HPP
+#define TRAJECTORY_HELPER__INSTRUMENTATION_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+/**
+ * Opt-in hot path instrumentation.
+ *
+ * Define TRAJECTORY_HELPER_INSTRUMENTATION (or configure CMake with
+ * -DTRAJECTORY_HELPER_INSTRUMENTATION=ON) to record call counts, cumulative and maximum
+ * latency and points processed per API. Without it TH_INSTRUMENT expands to nothing and the
+ * counters stay at zero. The setting must be the same in every translation unit of a program.
+ */
+#ifndef TRAJECTORY_HELPER_INSTRUMENTATION
+#define TRAJECTORY_HELPER_INSTRUMENTATION 0
+#endif
+
+namespace th {
+namespace instrumentation {
+
+enum class Api : size_t {
+    Calculate,
+    Interpolate,
+    InterpolateTrack,
+    Project,
+    FrenetSample,
+    Count
+};
+
+inline const char* api_name(Api api) {
+    switch (api) {
+        case Api::Calculate: return "calculate";
+        case Api::Interpolate: return "interpolate";
+        case Api::InterpolateTrack: return "interpolate_track";
+        case Api::Project: return "project";
+        case Api::FrenetSample: return "frenet_sample";
+        default: return "unknown";
+    }
+}
+
+struct ApiStats {
+    uint64_t calls = 0;
+    uint64_t total_ns = 0;
+    uint64_t max_ns = 0;
+    uint64_t points = 0;
+};
+
+struct Snapshot {
+    std::array<ApiStats, static_cast<size_t>(Api::Count)> apis;
+
+    const ApiStats& operator[](Api api) const { return apis[static_cast<size_t>(api)]; }
+};
+
+struct TraceEvent {
+    Api api;
+    uint64_t start_ns;
+    uint64_t duration_ns;
+    uint64_t points;
+    size_t thread_id;
+};
+
+class Registry {
+public:
+    // Upper bound on buffered trace events so a forgotten trace cannot grow without limit
+    static constexpr size_t max_trace_events = 1 << 20;
+
+    static Registry& instance() {
+        static Registry registry;
+        return registry;
+    }
+
+    void record(Api api, uint64_t start_ns, uint64_t duration_ns, uint64_t points) {
+        Counters& counters = counters_[static_cast<size_t>(api)];
+        counters.calls.fetch_add(1, std::memory_order_relaxed);
+        counters.total_ns.fetch_add(duration_ns, std::memory_order_relaxed);
+        counters.points.fetch_add(points, std::memory_order_relaxed);
+        uint64_t max_ns = counters.max_ns.load(std::memory_order_relaxed);
+        while (duration_ns > max_ns && !counters.max_ns.compare_exchange_weak(max_ns, duration_ns, std::memory_order_relaxed)) {}
+
+        if (trace_enabled_.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(trace_mutex_);
+            if (trace_events_.size() < max_trace_events) {
+                trace_events_.push_back({api, start_ns, duration_ns, points,
+                    std::hash<std::thread::id>()(std::this_thread::get_id())});
+            }
+        }
+    }
+
+    Snapshot snapshot() const {
+        Snapshot snapshot;
+        for (size_t i = 0; i < counters_.size(); ++i) {
+            snapshot.apis[i].calls = counters_[i].calls.load(std::memory_order_relaxed);
+            snapshot.apis[i].total_ns = counters_[i].total_ns.load(std::memory_order_relaxed);
+            snapshot.apis[i].max_ns = counters_[i].max_ns.load(std::memory_order_relaxed);
+            snapshot.apis[i].points = counters_[i].points.load(std::memory_order_relaxed);
+        }
+        return snapshot;
+    }
+
+    void reset() {
+        for (auto& counters : counters_) {
+            counters.calls.store(0, std::memory_order_relaxed);
+            counters.total_ns.store(0, std::memory_order_relaxed);
+            counters.max_ns.store(0, std::memory_order_relaxed);
+            counters.points.store(0, std::memory_order_relaxed);
+        }
+        std::lock_guard<std::mutex> lock(trace_mutex_);
+        trace_events_.clear();
+    }
+
+    void set_trace_enabled(bool enabled) { trace_enabled_.store(enabled, std::memory_order_relaxed); }
+
+    // Writes the buffered events in the Chrome trace-event format (chrome://tracing, Perfetto)
+    void write_chrome_trace(std::ostream& os) const {
+        std::lock_guard<std::mutex> lock(trace_mutex_);
+        os << "{\"traceEvents\":[";
+        for (size_t i = 0; i < trace_events_.size(); ++i) {
+            const TraceEvent& event = trace_events_[i];
+            if (i > 0) os << ",";
+            os << "{\"name\":\"" << api_name(event.api) << "\",\"cat\":\"trajectory_helper\",\"ph\":\"X\""
+               << ",\"ts\":" << event.start_ns / 1000.0
+               << ",\"dur\":" << event.duration_ns / 1000.0
+               << ",\"pid\":0,\"tid\":" << event.thread_id
+               << ",\"args\":{\"points\":" << event.points << "}}";
+        }
+        os << "]}";
+    }
+
+    static uint64_t now_ns() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+private:
+    struct Counters {
+        std::atomic<uint64_t> calls{0};
+        std::atomic<uint64_t> total_ns{0};
+        std::atomic<uint64_t> max_ns{0};
+        std::atomic<uint64_t> points{0};
+    };
+
+    Registry() = default;
+
+    std::array<Counters, static_cast<size_t>(Api::Count)> counters_;
+    std::atomic<bool> trace_enabled_{false};
+    mutable std::mutex trace_mutex_;
+    std::vector<TraceEvent> trace_events_;
+};
+
+inline Snapshot snapshot() { return Registry::instance().snapshot(); }
+inline void reset() { Registry::instance().reset(); }
+inline void set_trace_enabled(bool enabled) { Registry::instance().set_trace_enabled(enabled); }
+inline void write_chrome_trace(std::ostream& os) { Registry::instance().write_chrome_trace(os); }
+
+/**
+ * Records the lifetime of the scope as one call of api
+ */
+class ScopedTimer {
+public:
+    ScopedTimer(Api api, uint64_t points) : api_(api), points_(points), start_ns_(Registry::now_ns()) {}
+    ~ScopedTimer() {
+        Registry::instance().record(api_, start_ns_, Registry::now_ns() - start_ns_, points_);
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Api api_;
+    uint64_t points_;
+    uint64_t start_ns_;
+};
+
+}  // namespace instrumentation
+}  // namespace th
+
+#if TRAJECTORY_HELPER_INSTRUMENTATION
+#define TH_INSTRUMENT(api, points) \
+    ::th::instrumentation::ScopedTimer th_instrumentation_timer_(::th::instrumentation::Api::api, static_cast<uint64_t>(points))
+#else
+#define TH_INSTRUMENT(api, points) ((void)0)
+#endif
+
+#endif  // TRAJECTORY_HELPER__INSTRUMENTATION_HPP
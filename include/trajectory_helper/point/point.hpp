@@ -9,32 +9,56 @@ template<typename T>
 struct Point2 {
     T x, y;
 
-    Point2() : x(T()), y(T()) {}
-    Point2(T x, T y) : x(x), y(y) {}
+    constexpr Point2() : x(T()), y(T()) {}
+    constexpr Point2(T x, T y) : x(x), y(y) {}
 
-    Point2 operator+(const Point2& p) const { return Point2(x + p.x, y + p.y); }
-    Point2 operator-(const Point2& p) const { return Point2(x - p.x, y - p.y); }
-    Point2 operator*(T scale) const { return Point2(x * scale, y * scale); }
-    Point2 operator/(T scale) const { return Point2(x / scale, y / scale); }
+    constexpr Point2 operator+(const Point2& p) const { return Point2(x + p.x, y + p.y); }
+    constexpr Point2 operator-(const Point2& p) const { return Point2(x - p.x, y - p.y); }
+    constexpr Point2 operator*(T scale) const { return Point2(x * scale, y * scale); }
+    constexpr Point2 operator/(T scale) const { return Point2(x / scale, y / scale); }
 
-    Point2& operator+=(const Point2& p) { x += p.x; y += p.y; return *this; }
-    Point2& operator-=(const Point2& p) { x -= p.x; y -= p.y; return *this; }
-    Point2& operator*=(T scale) { x *= scale; y *= scale; return *this; }
-    Point2& operator/=(T scale) { x /= scale; y /= scale; return *this; }
+    constexpr Point2& operator+=(const Point2& p) { x += p.x; y += p.y; return *this; }
+    constexpr Point2& operator-=(const Point2& p) { x -= p.x; y -= p.y; return *this; }
+    constexpr Point2& operator*=(T scale) { x *= scale; y *= scale; return *this; }
+    constexpr Point2& operator/=(T scale) { x /= scale; y /= scale; return *this; }
 
     // dot product
-    T dot(const Point2& p) const { return x * p.x + y * p.y; }
+    constexpr T dot(const Point2& p) const { return x * p.x + y * p.y; }
     // cross product
-    T cross(const Point2& p) const { return x * p.y - y * p.x; }
+    constexpr T cross(const Point2& p) const { return x * p.y - y * p.x; }
 
     T norm() const { return std::hypot(x, y); }
 };
 
+template<typename T>
+struct Point3 {
+    T x, y, z;
+
+    constexpr Point3() : x(T()), y(T()), z(T()) {}
+    constexpr Point3(T x, T y, T z) : x(x), y(y), z(z) {}
+
+    constexpr Point3 operator+(const Point3& p) const { return Point3(x + p.x, y + p.y, z + p.z); }
+    constexpr Point3 operator-(const Point3& p) const { return Point3(x - p.x, y - p.y, z - p.z); }
+    constexpr Point3 operator*(T scale) const { return Point3(x * scale, y * scale, z * scale); }
+    constexpr Point3 operator/(T scale) const { return Point3(x / scale, y / scale, z / scale); }
+
+    // dot product
+    constexpr T dot(const Point3& p) const { return x * p.x + y * p.y + z * p.z; }
+
+    T norm() const { return std::hypot(x, y, z); }
+
+    // Projection onto the xy plane
+    constexpr Point2<T> xy() const { return Point2<T>(x, y); }
+};
+
 // Common type definitions
 typedef Point2<int> Point2i;
 typedef Point2<float> Point2f;
 typedef Point2<double> Point2d;
 
+typedef Point3<float> Point3f;
+typedef Point3<double> Point3d;
+
 }  // namespace th
 
 #endif  // TRAJECTORY_HELPER__POINT__POINT_HPP
\ No newline at end of file
@@ -0,0 +1,191 @@
+#ifndef TRAJECTORY_HELPER__SPATIAL__GRID_INDEX_HPP
+#define TRAJECTORY_HELPER__SPATIAL__GRID_INDEX_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#include "trajectory_helper/point/point.hpp"
+
+namespace th {
+
+/**
+ * Uniform hash grid over the plane storing item ids.
+ *
+ * Points go into one cell, boxes (e.g. segments) into every cell they overlap. Cells are kept
+ * in a hash map, so the grid is unbounded and supports incremental inserts. Queries visit the
+ * cells of a box or the square rings of cells around a query cell, clipped to the bounding box
+ * of the occupied cells.
+ */
+template<typename T>
+class GridIndex2 {
+public:
+    explicit GridIndex2(T cell_size = T(1))
+    : cell_size_(cell_size), inv_cell_size_(T(1) / cell_size)
+    {
+        if (!(cell_size > T(0))) {
+            throw std::runtime_error("Grid cell size must be positive.");
+        }
+    }
+
+    T cell_size() const { return cell_size_; }
+    bool empty() const { return cells_.empty(); }
+    size_t num_cells() const { return cells_.size(); }
+
+    void clear() {
+        cells_.clear();
+        min_cx_ = min_cy_ = std::numeric_limits<std::int64_t>::max();
+        max_cx_ = max_cy_ = std::numeric_limits<std::int64_t>::min();
+    }
+
+    std::int64_t cell_coord(T v) const {
+        return static_cast<std::int64_t>(std::floor(v * inv_cell_size_));
+    }
+
+    void insert(size_t id, const Point2<T>& point) {
+        insert_cell(cell_coord(point.x), cell_coord(point.y), id);
+    }
+
+    // Inserts id into every cell overlapping the box [min, max]
+    void insert(size_t id, const Point2<T>& min, const Point2<T>& max) {
+        const std::int64_t cx0 = cell_coord(min.x), cx1 = cell_coord(max.x);
+        const std::int64_t cy0 = cell_coord(min.y), cy1 = cell_coord(max.y);
+        for (std::int64_t cx = cx0; cx <= cx1; ++cx) {
+            for (std::int64_t cy = cy0; cy <= cy1; ++cy) {
+                insert_cell(cx, cy, id);
+            }
+        }
+    }
+
+    /**
+     * Calls fn(id) for every id in the cells overlapping the box [min, max]. Ids inserted as
+     * boxes can be reported once per shared cell.
+     */
+    template<typename Fn>
+    void for_each_in_box(const Point2<T>& min, const Point2<T>& max, Fn&& fn) const {
+        if (cells_.empty()) return;
+        const std::int64_t cx0 = std::max(cell_coord(min.x), min_cx_), cx1 = std::min(cell_coord(max.x), max_cx_);
+        const std::int64_t cy0 = std::max(cell_coord(min.y), min_cy_), cy1 = std::min(cell_coord(max.y), max_cy_);
+        for (std::int64_t cx = cx0; cx <= cx1; ++cx) {
+            for (std::int64_t cy = cy0; cy <= cy1; ++cy) {
+                visit_cell(cx, cy, fn);
+            }
+        }
+    }
+
+    /**
+     * Calls fn(id) for every id in the cells at Chebyshev distance ring from cell (cx, cy).
+     * Every item in ring r is at least (r - 1) * cell_size away from any point of cell (cx, cy).
+     * Only the part of the ring overlapping the occupied cells is visited.
+     */
+    template<typename Fn>
+    void for_each_in_ring(std::int64_t cx, std::int64_t cy, std::int64_t ring, Fn&& fn) const {
+        if (cells_.empty()) return;
+        if (ring == 0) {
+            visit_cell(cx, cy, fn);
+            return;
+        }
+        const std::int64_t x0 = std::max(cx - ring, min_cx_), x1 = std::min(cx + ring, max_cx_);
+        const std::int64_t y0 = std::max(cy - ring + 1, min_cy_), y1 = std::min(cy + ring - 1, max_cy_);
+        for (std::int64_t y : {cy - ring, cy + ring}) {
+            if (y < min_cy_ || y > max_cy_) continue;
+            for (std::int64_t x = x0; x <= x1; ++x) {
+                visit_cell(x, y, fn);
+            }
+        }
+        for (std::int64_t x : {cx - ring, cx + ring}) {
+            if (x < min_cx_ || x > max_cx_) continue;
+            for (std::int64_t y = y0; y <= y1; ++y) {
+                visit_cell(x, y, fn);
+            }
+        }
+    }
+
+    // Number of cells for_each_in_ring looks up
+    std::int64_t ring_cells(std::int64_t cx, std::int64_t cy, std::int64_t ring) const {
+        if (cells_.empty()) return 0;
+        if (ring == 0) return 1;
+        const std::int64_t nx = std::max(std::min(cx + ring, max_cx_) - std::max(cx - ring, min_cx_) + 1, std::int64_t(0));
+        const std::int64_t ny = std::max(std::min(cy + ring - 1, max_cy_) - std::max(cy - ring + 1, min_cy_) + 1, std::int64_t(0));
+        auto rows = [](std::int64_t a, std::int64_t b, std::int64_t lo, std::int64_t hi) {
+            return std::int64_t(a >= lo && a <= hi) + std::int64_t(b >= lo && b <= hi);
+        };
+        return rows(cy - ring, cy + ring, min_cy_, max_cy_) * nx + rows(cx - ring, cx + ring, min_cx_, max_cx_) * ny;
+    }
+
+    // Ring before which no occupied cell exists around cell (cx, cy)
+    std::int64_t min_ring(std::int64_t cx, std::int64_t cy) const {
+        if (cells_.empty()) return 0;
+        return std::max({min_cx_ - cx, cx - max_cx_, min_cy_ - cy, cy - max_cy_, std::int64_t(0)});
+    }
+
+    // Ring beyond which no occupied cell exists around cell (cx, cy)
+    std::int64_t max_ring(std::int64_t cx, std::int64_t cy) const {
+        if (cells_.empty()) return -1;
+        return std::max({cx - min_cx_, max_cx_ - cx, cy - min_cy_, max_cy_ - cy, std::int64_t(0)});
+    }
+
+    /**
+     * Nearest neighbour walk: visits the rings around cell (cx, cy) from min_ring outwards,
+     * calling fn(id) for their ids and done(ring) after each ring, until done returns true or
+     * max_ring is reached. Items beyond ring r are at least r * cell_size away from the cell.
+     *
+     * The walk gives up before it would look up more cells than are occupied, so a query far
+     * from the items costs at most num_cells() lookups. Returns false when it gave up; the
+     * caller then scans all items (fn may already have seen some of them).
+     */
+    template<typename Fn, typename Done>
+    bool for_each_ring(std::int64_t cx, std::int64_t cy, Fn&& fn, Done&& done) const {
+        std::int64_t budget = static_cast<std::int64_t>(cells_.size());
+        const std::int64_t last = max_ring(cx, cy);
+        for (std::int64_t ring = min_ring(cx, cy); ring <= last; ++ring) {
+            budget -= ring_cells(cx, cy, ring);
+            if (budget < 0) return false;
+            for_each_in_ring(cx, cy, ring, fn);
+            if (done(ring)) break;
+        }
+        return true;
+    }
+
+private:
+    static std::uint64_t key(std::int64_t cx, std::int64_t cy) {
+        return (static_cast<std::uint64_t>(cx) << 32) ^ (static_cast<std::uint64_t>(cy) & 0xffffffffull);
+    }
+
+    void insert_cell(std::int64_t cx, std::int64_t cy, size_t id) {
+        cells_[key(cx, cy)].push_back(id);
+        min_cx_ = std::min(min_cx_, cx);
+        max_cx_ = std::max(max_cx_, cx);
+        min_cy_ = std::min(min_cy_, cy);
+        max_cy_ = std::max(max_cy_, cy);
+    }
+
+    template<typename Fn>
+    void visit_cell(std::int64_t cx, std::int64_t cy, Fn& fn) const {
+        if (cx < min_cx_ || cx > max_cx_ || cy < min_cy_ || cy > max_cy_) return;
+        auto it = cells_.find(key(cx, cy));
+        if (it == cells_.end()) return;
+        for (size_t id : it->second) {
+            fn(id);
+        }
+    }
+
+    T cell_size_;
+    T inv_cell_size_;
+    std::unordered_map<std::uint64_t, std::vector<size_t>> cells_;
+    std::int64_t min_cx_ = std::numeric_limits<std::int64_t>::max();
+    std::int64_t min_cy_ = std::numeric_limits<std::int64_t>::max();
+    std::int64_t max_cx_ = std::numeric_limits<std::int64_t>::min();
+    std::int64_t max_cy_ = std::numeric_limits<std::int64_t>::min();
+};
+
+typedef GridIndex2<float> GridIndex2f;
+typedef GridIndex2<double> GridIndex2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__SPATIAL__GRID_INDEX_HPP
@@ -0,0 +1,175 @@
+#ifndef TRAJECTORY_HELPER__TRACK__FIXED_TRACK_HPP
+#define TRAJECTORY_HELPER__TRACK__FIXED_TRACK_HPP
+
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+
+#include "trajectory_helper/instrumentation.hpp"
+#include "trajectory_helper/point/point.hpp"
+#include "trajectory_helper/track/track_point.hpp"
+#include "trajectory_helper/track/track_algorithm.hpp"
+
+namespace th {
+
+/**
+ * Track with a compile-time capacity of N points, stored inline in a std::array.
+ *
+ * Offers the same algorithms as Track2 without any dynamic allocation: batch results are
+ * written through output iterators and resampling returns another FixedTrack2.
+ */
+template<typename T, size_t N>
+class FixedTrack2 {
+public:
+    using value_type = TrackPoint2<T>;
+    using size_type = size_t;
+    using reference = TrackPoint2<T>&;
+    using const_reference = const TrackPoint2<T>&;
+    using iterator = typename std::array<TrackPoint2<T>, N>::iterator;
+    using const_iterator = typename std::array<TrackPoint2<T>, N>::const_iterator;
+
+    constexpr FixedTrack2() : points_(), size_(0) {}
+
+    FixedTrack2(std::initializer_list<TrackPoint2<T>> points)
+    : FixedTrack2(points.begin(), points.end())
+    {}
+
+    template<typename InputIt>
+    FixedTrack2(InputIt first, InputIt last)
+    : points_(), size_(0)
+    {
+        for (; first != last; ++first) {
+            push_back(TrackPoint2<T>(*first));
+        }
+    }
+
+    static constexpr size_t capacity() { return N; }
+    constexpr size_t size() const { return size_; }
+    constexpr bool empty() const { return size_ == 0; }
+
+    constexpr iterator begin() { return points_.begin(); }
+    constexpr iterator end() { return points_.begin() + size_; }
+    constexpr const_iterator begin() const { return points_.begin(); }
+    constexpr const_iterator end() const { return points_.begin() + size_; }
+
+    constexpr TrackPoint2<T>& operator[](size_t i) { return points_[i]; }
+    constexpr const TrackPoint2<T>& operator[](size_t i) const { return points_[i]; }
+
+    TrackPoint2<T>& at(size_t i) {
+        if (i >= size_) {
+            throw std::out_of_range("FixedTrack2 index out of range.");
+        }
+        return points_[i];
+    }
+    const TrackPoint2<T>& at(size_t i) const {
+        if (i >= size_) {
+            throw std::out_of_range("FixedTrack2 index out of range.");
+        }
+        return points_[i];
+    }
+
+    constexpr TrackPoint2<T>& front() { return points_[0]; }
+    constexpr const TrackPoint2<T>& front() const { return points_[0]; }
+    constexpr TrackPoint2<T>& back() { return points_[size_ - 1]; }
+    constexpr const TrackPoint2<T>& back() const { return points_[size_ - 1]; }
+
+    void push_back(const TrackPoint2<T>& point) {
+        if (size_ >= N) {
+            throw std::length_error("FixedTrack2 capacity exceeded.");
+        }
+        points_[size_++] = point;
+    }
+
+    void resize(size_t n) {
+        if (n > N) {
+            throw std::length_error("FixedTrack2 capacity exceeded.");
+        }
+        for (size_t i = size_; i < n; ++i) {
+            points_[i] = TrackPoint2<T>();
+        }
+        size_ = n;
+    }
+
+    constexpr void clear() { size_ = 0; }
+
+    // Column accessors writing into caller-provided storage
+    template<typename OutputIt> OutputIt s(OutputIt out) const { for (const auto& p : *this) *out++ = p.s; return out; }
+    template<typename OutputIt> OutputIt x(OutputIt out) const { for (const auto& p : *this) *out++ = p.x; return out; }
+    template<typename OutputIt> OutputIt y(OutputIt out) const { for (const auto& p : *this) *out++ = p.y; return out; }
+    template<typename OutputIt> OutputIt psi(OutputIt out) const { for (const auto& p : *this) *out++ = p.psi; return out; }
+    template<typename OutputIt> OutputIt kappa(OutputIt out) const { for (const auto& p : *this) *out++ = p.kappa; return out; }
+    template<typename OutputIt> OutputIt wr(OutputIt out) const { for (const auto& p : *this) *out++ = p.wr; return out; }
+    template<typename OutputIt> OutputIt wl(OutputIt out) const { for (const auto& p : *this) *out++ = p.wl; return out; }
+
+    bool has_s() const { return !empty() && front().has_s(); }
+    bool has_psi() const { return !empty() && front().has_psi(); }
+    bool has_kappa() const { return !empty() && front().has_kappa(); }
+    bool has_widths() const { return !empty() && front().has_widths(); }
+
+    template<typename Math = StdMath>
+    void calculate(
+        bool is_closed = true,
+        double stepsize_psi_preview = 1.0,
+        double stepsize_psi_review = 1.0,
+        double stepsize_curv_preview = 1.0,
+        double stepsize_curv_review = 1.0,
+        bool calc_curv = true)
+    {
+        TH_INSTRUMENT(Calculate, size_);
+        calculate_track<Math>(begin(), end(), is_closed,
+            stepsize_psi_preview, stepsize_psi_review,
+            stepsize_curv_preview, stepsize_curv_review, calc_curv);
+    }
+
+    template<typename InputIt, typename OutputIt>
+    OutputIt interpolate(InputIt s_first, InputIt s_last, OutputIt out, bool is_closed = true) const {
+        TH_INSTRUMENT(Interpolate, std::distance(s_first, s_last));
+        return interpolate_track_points(begin(), end(), s_first, s_last, out, is_closed);
+    }
+
+    TrackPoint2<T> interpolate(const T& s_query, bool is_closed = true) const {
+        TH_INSTRUMENT(Interpolate, 1);
+        return interpolate_track_point(begin(), end(), s_query, is_closed);
+    }
+
+    FixedTrack2 interpolate_track(T stepsize, bool is_closed = true) const {
+        TH_INSTRUMENT(InterpolateTrack, size_);
+        if (resample_size(begin(), end(), stepsize, is_closed) > N) {
+            throw std::length_error("FixedTrack2 capacity exceeded.");
+        }
+
+        FixedTrack2 new_track;
+        new_track.size_ = static_cast<size_t>(
+            resample_track(begin(), end(), stepsize, new_track.points_.begin(), is_closed) - new_track.points_.begin());
+        new_track.calculate(is_closed);
+        return new_track;
+    }
+
+    TrackPoint2<T> project(const Point2<T>& point, bool is_closed = true) const {
+        TH_INSTRUMENT(Project, size_);
+        return project_on_track(begin(), end(), point, is_closed);
+    }
+
+    TrackPoint2<T> project(const Point2<T>& point, size_t hint_idx, size_t window, bool is_closed = true) const {
+        TH_INSTRUMENT(Project, std::min(2 * window + 1, size_));
+        return project_on_track(begin(), end(), point, hint_idx, window, is_closed);
+    }
+
+private:
+    std::array<TrackPoint2<T>, N> points_;
+    size_t size_;
+};
+
+template<size_t N> using FixedTrack2f = FixedTrack2<float, N>;
+template<size_t N> using FixedTrack2d = FixedTrack2<double, N>;
+
+template<typename T, size_t N>
+size_t find_nearest_idx(const FixedTrack2<T, N>& track, const Point2<T>& point) {
+    return find_nearest_idx(track.begin(), track.end(), point);
+}
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__FIXED_TRACK_HPP
@@ -0,0 +1,205 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK3_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK3_HPP
+
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include <stdexcept>
+#include <cmath>
+#include <iterator>
+#include <type_traits>
+
+#include "trajectory_helper/utils.hpp"
+#include "trajectory_helper/instrumentation.hpp"
+#include "trajectory_helper/point/point.hpp"
+#include "trajectory_helper/track/track_point.hpp"
+#include "trajectory_helper/track/track_algorithm.hpp"
+
+namespace th {
+
+/**
+ * Track with elevation, slope and banking.
+ *
+ * Runs the same algorithm templates as Track2; the elevation code is selected at compile time
+ * from the point type, so Track2 is not affected. s is the arc length in 3D, psi the heading
+ * in the xy plane, kappa its change per 3D arc length (dpsi/ds) and slope the pitch angle
+ * calculated from the elevation; bank is surveyed input interpolated like the widths. Projections search the segments in 3D, so a point on
+ * a bridge finds the bridge rather than the road below.
+ */
+template<typename T, typename Allocator = std::allocator<TrackPoint3<T>>>
+class Track3 : public std::vector<TrackPoint3<T>, Allocator> {
+    static_assert(std::is_floating_point<T>::value, "Track3 requires floating point coordinates.");
+
+public:
+    // Vectors of T sharing the allocator of the track (used for the columns)
+    using column_type = std::vector<T, typename std::allocator_traits<Allocator>::template rebind_alloc<T>>;
+    using point_vector_type = std::vector<TrackPoint3<T>, Allocator>;
+
+    // Inherit vector constructors
+    using std::vector<TrackPoint3<T>, Allocator>::vector;
+
+    explicit Track3(const std::vector<Point3<T>>& points, const Allocator& alloc = Allocator())
+    : std::vector<TrackPoint3<T>, Allocator>(alloc)
+    {
+        if (points.size() < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+        this->reserve(points.size());
+        for (const auto& p : points) {
+            this->push_back(TrackPoint3<T>(p));
+        }
+    }
+
+    template<typename PointAllocator>
+    explicit Track3(const std::vector<TrackPoint3<T>, PointAllocator>& track_points, const Allocator& alloc = Allocator())
+    : std::vector<TrackPoint3<T>, Allocator>(track_points.begin(), track_points.end(), alloc)
+    {
+        if (track_points.size() < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+    }
+
+    column_type s() const { return column(&TrackPoint3<T>::s); }
+    column_type x() const { return column(&TrackPoint3<T>::x); }
+    column_type y() const { return column(&TrackPoint3<T>::y); }
+    column_type z() const { return column(&TrackPoint3<T>::z); }
+    column_type psi() const { return column(&TrackPoint3<T>::psi); }
+    column_type kappa() const { return column(&TrackPoint3<T>::kappa); }
+    column_type slope() const { return column(&TrackPoint3<T>::slope); }
+    column_type bank() const { return column(&TrackPoint3<T>::bank); }
+    column_type wr() const { return column(&TrackPoint3<T>::wr); }
+    column_type wl() const { return column(&TrackPoint3<T>::wl); }
+
+    // Column accessors writing into caller-provided storage instead of a new vector
+    template<typename OutputIt> OutputIt s(OutputIt out) const { for (const auto& p : *this) *out++ = p.s; return out; }
+    template<typename OutputIt> OutputIt x(OutputIt out) const { for (const auto& p : *this) *out++ = p.x; return out; }
+    template<typename OutputIt> OutputIt y(OutputIt out) const { for (const auto& p : *this) *out++ = p.y; return out; }
+    template<typename OutputIt> OutputIt z(OutputIt out) const { for (const auto& p : *this) *out++ = p.z; return out; }
+    template<typename OutputIt> OutputIt psi(OutputIt out) const { for (const auto& p : *this) *out++ = p.psi; return out; }
+    template<typename OutputIt> OutputIt kappa(OutputIt out) const { for (const auto& p : *this) *out++ = p.kappa; return out; }
+    template<typename OutputIt> OutputIt slope(OutputIt out) const { for (const auto& p : *this) *out++ = p.slope; return out; }
+    template<typename OutputIt> OutputIt bank(OutputIt out) const { for (const auto& p : *this) *out++ = p.bank; return out; }
+    template<typename OutputIt> OutputIt wr(OutputIt out) const { for (const auto& p : *this) *out++ = p.wr; return out; }
+    template<typename OutputIt> OutputIt wl(OutputIt out) const { for (const auto& p : *this) *out++ = p.wl; return out; }
+
+    void set_bank(const std::vector<T>& bank) {
+        if (bank.size() != this->size()) {
+            throw std::runtime_error("Bank vector must have the same size as the track.");
+        }
+        for (size_t i = 0; i < this->size(); ++i) {
+            this->at(i).bank = bank[i];
+        }
+    }
+
+    bool has_s() const { return !this->empty() && this->front().has_s(); }
+    bool has_psi() const { return !this->empty() && this->front().has_psi(); }
+    bool has_kappa() const { return !this->empty() && this->front().has_kappa(); }
+    bool has_widths() const { return !this->empty() && this->front().has_widths(); }
+    bool has_slope() const { return !this->empty() && this->front().has_slope(); }
+    bool has_bank() const { return !this->empty() && this->front().has_bank(); }
+
+    /**
+     * Calculates s, psi, kappa and slope; a missing bank is only defaulted to 0, not derived
+     * (see calculate_track)
+     */
+    template<typename Math = StdMath>
+    void calculate(
+        bool is_closed = true,
+        double stepsize_psi_preview = 1.0,
+        double stepsize_psi_review = 1.0,
+        double stepsize_curv_preview = 1.0,
+        double stepsize_curv_review = 1.0,
+        bool calc_curv = true)
+    {
+        TH_INSTRUMENT(Calculate, this->size());
+        calculate_track<Math>(this->begin(), this->end(), is_closed,
+            stepsize_psi_preview, stepsize_psi_review,
+            stepsize_curv_preview, stepsize_curv_review, calc_curv);
+    }
+
+    point_vector_type interpolate(const std::vector<T>& query_s, bool is_closed = true) const {
+        TH_INSTRUMENT(Interpolate, query_s.size());
+        check_interpolable();
+
+        point_vector_type interpolated_points(this->get_allocator());
+        interpolated_points.reserve(query_s.size());
+        interpolate_track_points(this->begin(), this->end(), query_s.begin(), query_s.end(),
+            std::back_inserter(interpolated_points), is_closed);
+        return interpolated_points;
+    }
+
+    template<typename InputIt, typename OutputIt>
+    OutputIt interpolate(InputIt s_first, InputIt s_last, OutputIt out, bool is_closed = true) const {
+        TH_INSTRUMENT(Interpolate, std::distance(s_first, s_last));
+        check_interpolable();
+
+        return interpolate_track_points(this->begin(), this->end(), s_first, s_last, out, is_closed);
+    }
+
+    TrackPoint3<T> interpolate(const T& s_query, bool is_closed = true) const {
+        TH_INSTRUMENT(Interpolate, 1);
+        return interpolate_track_point(this->begin(), this->end(), s_query, is_closed);
+    }
+
+    Track3 interpolate_track(T stepsize, bool is_closed = true) const {
+        Track3 new_track(this->get_allocator());
+        interpolate_track(stepsize, new_track, is_closed);
+        return new_track;
+    }
+
+    /**
+     * Resamples into a reusable track; no allocation once out has enough capacity.
+     * out must be a different track than *this.
+     */
+    template<typename OutAllocator>
+    void interpolate_track(T stepsize, Track3<T, OutAllocator>& out, bool is_closed = true) const {
+        TH_INSTRUMENT(InterpolateTrack, this->size());
+        size_t n_points = resample_size(this->begin(), this->end(), stepsize, is_closed);
+        if (n_points < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+
+        out.resize(n_points);
+        resample_track(this->begin(), this->end(), stepsize, out.begin(), is_closed);
+        out.calculate(is_closed);
+    }
+
+    TrackPoint3<T> project(const Point3<T>& point, bool is_closed = true) const {
+        TH_INSTRUMENT(Project, this->size());
+        return project_on_track(this->begin(), this->end(), point, is_closed);
+    }
+
+    /**
+     * Warm-started projection: only the segments within +-window of hint_idx are searched
+     */
+    TrackPoint3<T> project(const Point3<T>& point, size_t hint_idx, size_t window, bool is_closed = true) const {
+        TH_INSTRUMENT(Project, std::min(2 * window + 1, this->size()));
+        return project_on_track(this->begin(), this->end(), point, hint_idx, window, is_closed);
+    }
+
+private:
+    column_type column(T TrackPoint3<T>::*member) const {
+        column_type values(this->get_allocator());
+        values.reserve(this->size());
+        for (const auto& p : *this) {
+            values.push_back(p.*member);
+        }
+        return values;
+    }
+
+    void check_interpolable() const {
+        if (this->empty()) {
+            throw std::runtime_error("Track is empty!");
+        }
+        if (!this->has_s()) {
+            throw std::runtime_error("Track must have s values to interpolate! Call calculate() first.");
+        }
+    }
+}; // class Track3
+
+typedef Track3<float> Track3f;
+typedef Track3<double> Track3d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK3_HPP
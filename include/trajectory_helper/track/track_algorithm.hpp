@@ -0,0 +1,772 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_ALGORITHM_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_ALGORITHM_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "trajectory_helper/utils.hpp"
+#include "trajectory_helper/math_kernels.hpp"
+#include "trajectory_helper/point/point.hpp"
+#include "trajectory_helper/track/track_point.hpp"
+
+namespace th {
+
+/**
+ * Track algorithms written against random access iterators over TrackPoint2<T> or
+ * TrackPoint3<T>.
+ *
+ * They are shared by every track storage (Track2, Track3, FixedTrack2, ...). Batch results
+ * are written through output iterators supplied by the caller, and only the nearest-neighbour
+ * queries (find_k_nearest_idx, find_within_radius_idx) allocate scratch storage.
+ * Elevation is handled in `if constexpr (is_track_point3_v<...>)` branches, which do not
+ * exist in the 2D instantiations.
+ */
+
+// Scalar type T of an iterator over TrackPoint2<T> or TrackPoint3<T>
+template<typename RandomIt>
+using track_value_t = std::decay_t<decltype(std::declval<typename std::iterator_traits<RandomIt>::reference>().x)>;
+
+// Point type (TrackPoint2<T> or TrackPoint3<T>) of an iterator
+template<typename RandomIt>
+using track_point_t = std::decay_t<typename std::iterator_traits<RandomIt>::reference>;
+
+// Query point type of the projections: Point3<T> for tracks with elevation, Point2<T> otherwise
+template<typename RandomIt>
+using track_query_t = std::conditional_t<is_track_point3_v<track_point_t<RandomIt>>,
+    Point3<track_value_t<RandomIt>>, Point2<track_value_t<RandomIt>>>;
+
+/**
+ * Length of the element between two track points, including the height difference for
+ * points with elevation
+ */
+template<typename Math = StdMath, typename P>
+auto element_length(const P& p1, const P& p2) {
+    if constexpr (is_track_point3_v<P>) {
+        return Math::hypot(Math::distance(p1, p2), p2.z - p1.z);
+    } else {
+        return Math::distance(p1, p2);
+    }
+}
+
+/**
+ * Total length of the track, including the last→first edge for closed tracks
+ * Requires s values (see calculate_track)
+ */
+template<typename RandomIt>
+track_value_t<RandomIt> track_length(RandomIt first, RandomIt last, bool is_closed = true) {
+    const auto& back = *std::prev(last);
+    if (is_closed) {
+        return back.s + element_length(back, *first);
+    }
+    return back.s - first->s;
+}
+
+namespace detail {
+
+/**
+ * Window of stepsize in index steps, at least 1. Tracks of zero length give inf or NaN
+ * quotients, which are clamped instead of converted (undefined behaviour).
+ */
+template<typename T>
+size_t index_step(double stepsize, T avg_el_length) {
+    T steps = std::round(static_cast<T>(stepsize) / avg_el_length);
+    if (!(steps >= T(1))) {
+        return 1;
+    }
+    return static_cast<size_t>(std::min(steps, static_cast<T>(std::numeric_limits<int>::max())));
+}
+
+// Points per block of the column kernels of calculate_track (scratch columns on the stack)
+constexpr size_t kernel_block = 64;
+
+/**
+ * Headings (and slopes for points with elevation) of the points [begin, end), whose windows
+ * [i - review, i + preview] lie inside the track.
+ *
+ * Every block gathers the window differences into plain columns, runs the kernel over the
+ * columns and scatters the results. The kernel loop has no branches and no calls besides
+ * Math::atan2/hypot, so it vectorizes when those inline (FastMath); StdMath calls libm per point.
+ */
+template<typename Math, typename RandomIt>
+void calculate_headings(RandomIt first, size_t begin, size_t end, size_t preview, size_t review) {
+    using T = track_value_t<RandomIt>;
+    constexpr size_t B = kernel_block;
+
+    T dx[B], dy[B], psi[B];
+    for (size_t b = begin; b < end; b += B) {
+        const size_t m = std::min(B, end - b);
+        for (size_t k = 0; k < m; ++k) {
+            dx[k] = first[b + k + preview].x - first[b + k - review].x;
+            dy[k] = first[b + k + preview].y - first[b + k - review].y;
+        }
+        for (size_t k = 0; k < m; ++k) {
+            psi[k] = wrap_psi(Math::atan2(dy[k], dx[k]));
+        }
+        for (size_t k = 0; k < m; ++k) {
+            first[b + k].psi = psi[k];
+        }
+
+        if constexpr (is_track_point3_v<track_point_t<RandomIt>>) {
+            T dz[B], slope[B];
+            for (size_t k = 0; k < m; ++k) {
+                dz[k] = first[b + k + preview].z - first[b + k - review].z;
+            }
+            for (size_t k = 0; k < m; ++k) {
+                slope[k] = Math::atan2(dz[k], Math::hypot(dx[k], dy[k]));
+            }
+            for (size_t k = 0; k < m; ++k) {
+                first[b + k].slope = slope[k];
+            }
+        }
+    }
+}
+
+/**
+ * Curvatures of the points [begin, end) from the headings and stations of their windows
+ * (see calculate_headings). The kernel is arithmetic only and vectorizes for both Math policies.
+ */
+template<typename RandomIt>
+void calculate_curvatures(RandomIt first, size_t begin, size_t end, size_t preview, size_t review) {
+    using T = track_value_t<RandomIt>;
+    constexpr size_t B = kernel_block;
+
+    T dpsi[B], ds[B], kappa[B];
+    for (size_t b = begin; b < end; b += B) {
+        const size_t m = std::min(B, end - b);
+        for (size_t k = 0; k < m; ++k) {
+            dpsi[k] = first[b + k + preview].psi - first[b + k - review].psi;
+            ds[k] = first[b + k + preview].s - first[b + k - review].s;
+        }
+        for (size_t k = 0; k < m; ++k) {
+            kappa[k] = wrap_psi(dpsi[k]) / ds[k];
+        }
+        for (size_t k = 0; k < m; ++k) {
+            first[b + k].kappa = kappa[k];
+        }
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Calculates s, psi and kappa in place. Math selects the atan2/hypot kernels
+ * (StdMath or FastMath, see math_kernels.hpp).
+ *
+ * Points with elevation also get the slope over the heading windows, the pitch angle
+ * atan2(dz, hypot(dx, dy)) from the review to the preview point in radians. Their kappa is the
+ * change of the xy heading per 3D arc length, the unit of their s. Bank is surveyed data like
+ * the widths and is only defaulted to flat (0) where missing.
+ */
+template<typename Math = StdMath, typename RandomIt>
+void calculate_track(
+    RandomIt first,
+    RandomIt last,
+    bool is_closed = true,
+    double stepsize_psi_preview = 1.0,
+    double stepsize_psi_review = 1.0,
+    double stepsize_curv_preview = 1.0,
+    double stepsize_curv_review = 1.0,
+    bool calc_curv = true)
+{
+    using T = track_value_t<RandomIt>;
+    constexpr bool has_elevation = is_track_point3_v<track_point_t<RandomIt>>;
+
+    const size_t n = static_cast<size_t>(std::distance(first, last));
+    if (n < 2) {
+        throw std::runtime_error("Track must have at least 2 points!");
+    }
+    auto p = [&first](size_t i) -> decltype(auto) { return first[i]; };
+
+    // 1) Cumulative path length s; the element lengths are s[i + 1] - s[i]
+    p(0).s = T();
+    for (size_t i = 1; i < n; ++i) {
+        p(i).s = p(i - 1).s + element_length<Math>(p(i - 1), p(i));
+    }
+    if constexpr (has_elevation) {
+        for (size_t i = 0; i < n; ++i) {
+            p(i).bank = p(i).has_bank() ? p(i).bank : T();
+        }
+    }
+
+    // 2) If the track is closed, add the last→first edge
+    const T total_length = is_closed ? p(n - 1).s + element_length<Math>(p(n - 1), p(0)) : p(n - 1).s;
+    const size_t n_elements = is_closed ? n : n - 1;
+    T avg_el_length = total_length / static_cast<T>(n_elements);
+
+    // Calculate step indices using T for calculations
+    size_t ind_step_preview_psi = detail::index_step(stepsize_psi_preview, avg_el_length);
+    size_t ind_step_review_psi = detail::index_step(stepsize_psi_review, avg_el_length);
+    size_t ind_step_preview_curv = detail::index_step(stepsize_curv_preview, avg_el_length);
+    size_t ind_step_review_curv = detail::index_step(stepsize_curv_review, avg_el_length);
+
+    auto heading = [&p](size_t i, size_t preview_idx, size_t review_idx) {
+        T dx = p(preview_idx).x - p(review_idx).x;
+        T dy = p(preview_idx).y - p(review_idx).y;
+        p(i).psi = normalize_psi(Math::atan2(dy, dx));
+        if constexpr (has_elevation) {
+            p(i).slope = Math::atan2(p(preview_idx).z - p(review_idx).z, Math::hypot(dx, dy));
+        }
+    };
+
+    // Interior points [review, n - preview) have both window ends inside the track
+    auto interior = [n](size_t preview, size_t review) {
+        size_t begin = std::min(review, n);
+        size_t end = preview < n ? std::max(begin, n - preview) : begin;
+        return std::make_pair(begin, end);
+    };
+
+    // Points near the ends have windows crossing the seam (closed) or clamped at the ends (open)
+    // and are handled one by one; all others go through the column kernels in detail.
+    if (is_closed) {
+        // Calculate heading (psi)
+        auto heading_wrapped = [&](size_t i) {
+            heading(i, (i + ind_step_preview_psi) % n, (i + n - ind_step_review_psi % n) % n);
+        };
+        auto psi_range = interior(ind_step_preview_psi, ind_step_review_psi);
+        for (size_t i = 0; i < psi_range.first; ++i) {
+            heading_wrapped(i);
+        }
+        detail::calculate_headings<Math>(first, psi_range.first, psi_range.second, ind_step_preview_psi, ind_step_review_psi);
+        for (size_t i = psi_range.second; i < n; ++i) {
+            heading_wrapped(i);
+        }
+
+        // Calculate curvature (kappa)
+        if (calc_curv) {
+            auto curvature_wrapped = [&](size_t i) {
+                size_t preview_idx = (i + ind_step_preview_curv) % n;
+                size_t review_idx = (i + n - ind_step_review_curv % n) % n;
+
+                T delta_psi = angle_diff(p(preview_idx).psi, p(review_idx).psi);
+
+                // Path length between review and preview points from the cumulative lengths
+                T path_length = review_idx < preview_idx
+                    ? p(preview_idx).s - p(review_idx).s
+                    : total_length - p(review_idx).s + p(preview_idx).s;
+
+                p(i).kappa = delta_psi / path_length;
+            };
+            auto curv_range = interior(ind_step_preview_curv, ind_step_review_curv);
+            for (size_t i = 0; i < curv_range.first; ++i) {
+                curvature_wrapped(i);
+            }
+            detail::calculate_curvatures(first, curv_range.first, curv_range.second, ind_step_preview_curv, ind_step_review_curv);
+            for (size_t i = curv_range.second; i < n; ++i) {
+                curvature_wrapped(i);
+            }
+        }
+    } else {
+        // Open tracks clamp the windows at the ends. Curvature divides by the path length
+        // s[preview] - s[review].
+
+        // Calculate heading (psi)
+        auto heading_clamped = [&](size_t i) {
+            heading(i, std::min(i + ind_step_preview_psi, n - 1), i > ind_step_review_psi ? i - ind_step_review_psi : 0);
+        };
+        auto psi_range = interior(ind_step_preview_psi, ind_step_review_psi);
+        for (size_t i = 0; i < psi_range.first; ++i) {
+            heading_clamped(i);
+        }
+        detail::calculate_headings<Math>(first, psi_range.first, psi_range.second, ind_step_preview_psi, ind_step_review_psi);
+        for (size_t i = psi_range.second; i < n; ++i) {
+            heading_clamped(i);
+        }
+
+        // Calculate curvature (kappa)
+        if (calc_curv) {
+            auto curvature_clamped = [&](size_t i) {
+                size_t preview_idx = std::min(i + ind_step_preview_curv, n - 1);
+                size_t review_idx = i > ind_step_review_curv ? i - ind_step_review_curv : 0;
+                T delta_psi = angle_diff(p(preview_idx).psi, p(review_idx).psi);
+                p(i).kappa = delta_psi / (p(preview_idx).s - p(review_idx).s);
+            };
+            auto curv_range = interior(ind_step_preview_curv, ind_step_review_curv);
+            for (size_t i = 0; i < curv_range.first; ++i) {
+                curvature_clamped(i);
+            }
+            detail::calculate_curvatures(first, curv_range.first, curv_range.second, ind_step_preview_curv, ind_step_review_curv);
+            for (size_t i = curv_range.second; i < n; ++i) {
+                curvature_clamped(i);
+            }
+        }
+    }
+}
+
+/**
+ * Linear interpolation between p1 and p2 at s_query, where s2 is the station of p2
+ * (differs from p2.s on the closing segment of a closed track)
+ */
+template<typename P>
+P interpolate_segment(const P& p1, const P& p2, decltype(P::s) s2, decltype(P::s) s_query) {
+    auto alpha = (s_query - p1.s) / (s2 - p1.s);  // Linear interpolation factor
+
+    P interpolated;
+    interpolated.s = s_query;
+    interpolated.x = p1.x + alpha * (p2.x - p1.x);
+    interpolated.y = p1.y + alpha * (p2.y - p1.y);
+    interpolated.psi = normalize_psi(p1.psi + alpha * angle_diff(p2.psi, p1.psi));
+    interpolated.kappa = p1.kappa + alpha * (p2.kappa - p1.kappa);
+    interpolated.wl = p1.wl + alpha * (p2.wl - p1.wl);
+    interpolated.wr = p1.wr + alpha * (p2.wr - p1.wr);
+    if constexpr (is_track_point3_v<P>) {
+        interpolated.z = p1.z + alpha * (p2.z - p1.z);
+        interpolated.slope = p1.slope + alpha * (p2.slope - p1.slope);
+        interpolated.bank = p1.bank + alpha * (p2.bank - p1.bank);
+    }
+    return interpolated;
+}
+
+/**
+ * Interpolates the track at s_query. Closed tracks wrap s_query around the track length,
+ * open tracks throw if s_query is outside [s_front, s_back].
+ */
+template<typename RandomIt>
+track_point_t<RandomIt> interpolate_track_point(
+    RandomIt first, RandomIt last, track_value_t<RandomIt> s_query, bool is_closed = true)
+{
+    using T = track_value_t<RandomIt>;
+
+    if (first == last) {
+        throw std::runtime_error("Track is empty!");
+    }
+    if (std::isinf(first->s)) {
+        throw std::runtime_error("Track must have s values to interpolate! Call calculate() first.");
+    }
+
+    const auto& front = *first;
+    const auto& back = *std::prev(last);
+
+    // Compute total track length
+    T s_min = front.s;
+    T s_max = is_closed ? back.s + element_length(back, front) : back.s;
+
+    // Handle closed track wrap-around
+    if (is_closed) {
+        if (s_query < s_min || s_query >= s_max) {
+            s_query = wrap_s(s_query, s_min, s_max - s_min);
+        }
+    } else {
+        if (s_query < s_min || s_query > s_max) {
+            throw std::runtime_error("Query s is out of track range!");
+        }
+    }
+
+    // Find the lower bound index using binary search
+    auto it = std::lower_bound(first, last, s_query,
+        [](const track_point_t<RandomIt>& p, T s) { return p.s < s; });
+
+    if (it == first) {
+        return front;
+    }
+    if (it == last) {
+        // Only reachable on the closing segment of a closed track
+        return is_closed ? interpolate_segment(back, front, s_max, s_query) : back;
+    }
+    return interpolate_segment(*std::prev(it), *it, it->s, s_query);
+}
+
+/**
+ * Interpolates the track at every s in [s_first, s_last), writing the results to out
+ */
+template<typename RandomIt, typename InputIt, typename OutputIt>
+OutputIt interpolate_track_points(
+    RandomIt first, RandomIt last, InputIt s_first, InputIt s_last, OutputIt out, bool is_closed = true)
+{
+    for (; s_first != s_last; ++s_first) {
+        *out++ = interpolate_track_point(first, last, *s_first, is_closed);
+    }
+    return out;
+}
+
+/**
+ * Number of points produced by resample_track for the given stepsize
+ */
+template<typename RandomIt>
+size_t resample_size(RandomIt first, RandomIt last, track_value_t<RandomIt> stepsize, bool is_closed = true) {
+    if (first == last) {
+        throw std::runtime_error("Track is empty!");
+    }
+    if (std::isinf(first->s)) {
+        throw std::runtime_error("Track must have s values to interpolate! Call calculate() first.");
+    }
+
+    track_value_t<RandomIt> length = track_length(first, last, is_closed);
+    if (is_closed) {
+        return static_cast<size_t>(std::floor(length / stepsize));
+    }
+    return static_cast<size_t>(std::floor(length / stepsize + 1));
+}
+
+/**
+ * Interpolates the track at evenly spaced s values (s_min + i * stepsize), writing the
+ * points to out. The result still needs calculate_track() for its own s/psi/kappa.
+ */
+template<typename RandomIt, typename OutputIt>
+OutputIt resample_track(RandomIt first, RandomIt last, track_value_t<RandomIt> stepsize, OutputIt out, bool is_closed = true) {
+    size_t n_points = resample_size(first, last, stepsize, is_closed);
+    auto s_min = first->s;
+    for (size_t i = 0; i < n_points; ++i) {
+        *out++ = interpolate_track_point(first, last, s_min + i * stepsize, is_closed);
+    }
+    return out;
+}
+
+/**
+ * Result of projecting a point onto the segments of a track (Point3<T> for tracks with
+ * elevation)
+ */
+template<typename T, typename Point = Point2<T>>
+struct SegmentProjection {
+    size_t segment = 0;  // Segment index, joining point segment and segment + 1
+    T t = T();           // Projection parameter along the segment in [0, 1]
+    T distance = std::numeric_limits<T>::max();
+    Point point;         // Projected point
+};
+
+/**
+ * Finds the closest projection of point onto `count` consecutive segments starting at
+ * first_seg, wrapping around on closed tracks. Segment i joins point i and point i + 1
+ * (the front for the last segment of a closed track). Tracks with elevation are searched
+ * in 3D.
+ */
+template<typename RandomIt>
+SegmentProjection<track_value_t<RandomIt>, track_query_t<RandomIt>> find_segment_projection(
+    RandomIt first, RandomIt last, const track_query_t<RandomIt>& point,
+    size_t first_seg, size_t count, bool is_closed = true)
+{
+    using T = track_value_t<RandomIt>;
+    constexpr bool has_elevation = is_track_point3_v<track_point_t<RandomIt>>;
+
+    const size_t n = static_cast<size_t>(std::distance(first, last));
+    if (n < 2) {
+        throw std::runtime_error("Track must have at least 2 points!");
+    }
+    const size_t n_segments = is_closed ? n : n - 1;
+
+    SegmentProjection<T, track_query_t<RandomIt>> best;
+
+    // Iterate through track segments to find closest projection
+    for (size_t k = 0; k < count; ++k) {
+        size_t i = (first_seg + k) % n_segments;
+        const auto& p1 = first[i];
+        const auto& p2 = first[(i + 1) % n];
+
+        // Calculate vectors
+        Point2<T> segment = {p2.x - p1.x, p2.y - p1.y};
+        Point2<T> to_point = {point.x - p1.x, point.y - p1.y};
+
+        // Calculate dot product and segment length
+        T dot = to_point.x * segment.x + to_point.y * segment.y;
+        T segment_length_sq = segment.x * segment.x + segment.y * segment.y;
+        if constexpr (has_elevation) {
+            T dz = p2.z - p1.z;
+            dot += (point.z - p1.z) * dz;
+            segment_length_sq += dz * dz;
+        }
+
+        // Calculate projection parameter (t)
+        T t = std::clamp(dot / segment_length_sq, T(0), T(1));
+
+        // Calculate projected point and its distance
+        track_query_t<RandomIt> curr_proj;
+        T curr_dist;
+        if constexpr (has_elevation) {
+            curr_proj = {p1.x + t * segment.x, p1.y + t * segment.y, p1.z + t * (p2.z - p1.z)};
+            curr_dist = std::hypot(point.x - curr_proj.x, point.y - curr_proj.y, point.z - curr_proj.z);
+        } else {
+            curr_proj = {
+                p1.x + t * segment.x,
+                p1.y + t * segment.y
+            };
+            curr_dist = distance(point, curr_proj);
+        }
+
+        if (curr_dist < best.distance) {
+            best.distance = curr_dist;
+            best.point = curr_proj;
+            best.segment = i;
+            best.t = t;
+        }
+    }
+    return best;
+}
+
+/**
+ * Segment range [first, first + count) within +-window of hint_idx, clamped on open tracks
+ * and wrapped on closed ones
+ */
+inline std::pair<size_t, size_t> segment_search_range(size_t n_segments, size_t hint_idx, size_t window, bool is_closed) {
+    if (2 * window + 1 >= n_segments) {
+        return {0, n_segments};
+    }
+    hint_idx = std::min(hint_idx, n_segments - 1);
+    if (is_closed) {
+        return {(hint_idx + n_segments - window) % n_segments, 2 * window + 1};
+    }
+    size_t first_seg = hint_idx > window ? hint_idx - window : 0;
+    size_t last_seg = std::min(hint_idx + window, n_segments - 1);
+    return {first_seg, last_seg - first_seg + 1};
+}
+
+/**
+ * Warm start state of a sweep of nearby points along a track (see sweep_segment_projection)
+ */
+struct SegmentSweep {
+    size_t segment = 0;  // Segment of the last projection
+    bool valid = false;  // false until the first projection
+};
+
+/**
+ * Projection for one point of a sweep: the points of another line in order, a stream of
+ * positions, ... The first point searches all segments; later ones search +-window of the
+ * previous segment and keep following the track while the best segment lies on an edge of
+ * the window, so a sweep that moves more than window segments per point still ends up on
+ * the closest segment near its path. Updates sweep.
+ */
+template<typename RandomIt>
+SegmentProjection<track_value_t<RandomIt>, track_query_t<RandomIt>> sweep_segment_projection(
+    RandomIt first, RandomIt last, const track_query_t<RandomIt>& point,
+    SegmentSweep& sweep, size_t window, bool is_closed = true)
+{
+    const size_t n = static_cast<size_t>(std::distance(first, last));
+    if (n < 2) {
+        throw std::runtime_error("Track must have at least 2 points!");
+    }
+    const size_t n_segments = is_closed ? n : n - 1;
+
+    if (!sweep.valid) {
+        auto best = find_segment_projection(first, last, point, 0, n_segments, is_closed);
+        sweep.segment = best.segment;
+        sweep.valid = true;
+        return best;
+    }
+
+    auto range = segment_search_range(n_segments, sweep.segment, window, is_closed);
+    auto best = find_segment_projection(first, last, point, range.first, range.second, is_closed);
+    // Re-center on the best segment while that keeps getting closer; a window edge at the end
+    // of an open track is a real end
+    for (size_t searched = range.second; range.second < n_segments && searched < n_segments;) {
+        const size_t last_seg = (range.first + range.second - 1) % n_segments;
+        const bool at_lower = best.segment == range.first && (is_closed || range.first > 0);
+        const bool at_upper = best.segment == last_seg && (is_closed || last_seg + 1 < n_segments);
+        if (!at_lower && !at_upper) {
+            break;
+        }
+        range = segment_search_range(n_segments, best.segment, window, is_closed);
+        auto next = find_segment_projection(first, last, point, range.first, range.second, is_closed);
+        searched += range.second;
+        if (!(next.distance < best.distance)) {
+            break;
+        }
+        best = next;
+    }
+    sweep.segment = best.segment;
+    return best;
+}
+
+/**
+ * Track point at a segment projection, interpolating the properties the track has
+ */
+template<typename RandomIt>
+track_point_t<RandomIt> segment_projection_point(
+    RandomIt first, RandomIt last, const SegmentProjection<track_value_t<RandomIt>, track_query_t<RandomIt>>& projection)
+{
+    using T = track_value_t<RandomIt>;
+
+    const size_t n = static_cast<size_t>(std::distance(first, last));
+    const auto& front = *first;
+    const auto& back = *std::prev(last);
+    const auto& p1 = first[projection.segment];
+    const auto& p2 = first[(projection.segment + 1) % n];
+    const T proj_t = projection.t;
+
+    track_point_t<RandomIt> interpolated;
+    interpolated.x = projection.point.x;  // Use already calculated projection
+    interpolated.y = projection.point.y;
+
+    // Only interpolate other properties if they exist in the track
+    if (front.has_s()) {
+        // The closing segment of a closed track ends at the total track length
+        T s2 = projection.segment + 1 < n ? p2.s : back.s + element_length(back, front);
+        interpolated.s = p1.s + proj_t * (s2 - p1.s);
+    }
+    if (front.has_psi()) {
+        interpolated.psi = normalize_psi(p1.psi + proj_t * angle_diff(p2.psi, p1.psi));
+    }
+    if (front.has_kappa()) {
+        interpolated.kappa = p1.kappa + proj_t * (p2.kappa - p1.kappa);
+    }
+    if (front.has_widths()) {
+        interpolated.wl = p1.wl + proj_t * (p2.wl - p1.wl);
+        interpolated.wr = p1.wr + proj_t * (p2.wr - p1.wr);
+    }
+    if constexpr (is_track_point3_v<track_point_t<RandomIt>>) {
+        interpolated.z = projection.point.z;
+        if (front.has_slope()) {
+            interpolated.slope = p1.slope + proj_t * (p2.slope - p1.slope);
+        }
+        if (front.has_bank()) {
+            interpolated.bank = p1.bank + proj_t * (p2.bank - p1.bank);
+        }
+    }
+
+    return interpolated;
+}
+
+/**
+ * Projects point onto `count` consecutive segments starting at first_seg
+ * (see find_segment_projection)
+ */
+template<typename RandomIt>
+track_point_t<RandomIt> project_on_segments(
+    RandomIt first, RandomIt last, const track_query_t<RandomIt>& point,
+    size_t first_seg, size_t count, bool is_closed = true)
+{
+    return segment_projection_point(first, last,
+        find_segment_projection(first, last, point, first_seg, count, is_closed));
+}
+
+template<typename RandomIt>
+track_point_t<RandomIt> project_on_track(
+    RandomIt first, RandomIt last, const track_query_t<RandomIt>& point, bool is_closed = true)
+{
+    size_t n = static_cast<size_t>(std::distance(first, last));
+    return project_on_segments(first, last, point, 0, is_closed ? n : n - 1, is_closed);
+}
+
+/**
+ * Warm-started projection: only the segments within +-window of hint_idx are searched.
+ * The hint is usually the segment index of a previous projection or a nearest point index.
+ */
+template<typename RandomIt>
+track_point_t<RandomIt> project_on_track(
+    RandomIt first, RandomIt last, const track_query_t<RandomIt>& point,
+    size_t hint_idx, size_t window, bool is_closed = true)
+{
+    size_t n = static_cast<size_t>(std::distance(first, last));
+    if (n < 2) {
+        throw std::runtime_error("Track must have at least 2 points!");
+    }
+    auto range = segment_search_range(is_closed ? n : n - 1, hint_idx, window, is_closed);
+    return project_on_segments(first, last, point, range.first, range.second, is_closed);
+}
+
+template<typename RandomIt>
+size_t find_nearest_idx(RandomIt first, RandomIt last, const Point2<track_value_t<RandomIt>>& point) {
+    using T = track_value_t<RandomIt>;
+
+    const size_t n = static_cast<size_t>(std::distance(first, last));
+    if (n < 2) return n == 0 ? 0 : 1;
+
+    T min_dist = std::numeric_limits<T>::max();
+    size_t nearest_idx = 0;
+
+    // Find nearest point
+    for (size_t i = 0; i < n; ++i) {
+        T dist = std::hypot(first[i].x - point.x, first[i].y - point.y);
+        if (dist < min_dist) {
+            min_dist = dist;
+            nearest_idx = i;
+        }
+    }
+    return nearest_idx;
+}
+
+namespace detail {
+
+/**
+ * Bounded max-heap keeping the k smallest (distance, index) pairs; ties go to the lower index.
+ * Allocates room for k pairs on construction.
+ */
+template<typename T>
+class NearestHeap {
+public:
+    explicit NearestHeap(size_t k) : k_(k) { heap_.reserve(k); }
+
+    size_t size() const { return heap_.size(); }
+    bool full() const { return heap_.size() == k_; }
+    void clear() { heap_.clear(); }
+
+    // Largest kept distance
+    T worst() const { return heap_.front().first; }
+
+    void push(T dist, size_t idx) {
+        std::pair<T, size_t> item(dist, idx);
+        if (heap_.size() < k_) {
+            heap_.push_back(item);
+            std::push_heap(heap_.begin(), heap_.end());
+        } else if (k_ > 0 && item < heap_.front()) {
+            std::pop_heap(heap_.begin(), heap_.end());
+            heap_.back() = item;
+            std::push_heap(heap_.begin(), heap_.end());
+        }
+    }
+
+    // Writes the kept indices by increasing distance and empties the heap
+    template<typename OutputIt>
+    OutputIt pop_sorted(OutputIt out) {
+        std::sort_heap(heap_.begin(), heap_.end());
+        for (const auto& item : heap_) {
+            *out++ = item.second;
+        }
+        heap_.clear();
+        return out;
+    }
+
+private:
+    size_t k_;
+    std::vector<std::pair<T, size_t>> heap_;
+};
+
+}  // namespace detail
+
+/**
+ * Indices of the k points closest to point by increasing distance (ties by index), written to
+ * out. Brute force in O(N log k); see TrackPointIndex2 for the indexed version. Allocates a
+ * heap of min(k, N) (distance, index) pairs.
+ */
+template<typename RandomIt, typename OutputIt>
+OutputIt find_k_nearest_idx(RandomIt first, RandomIt last, const Point2<track_value_t<RandomIt>>& point, size_t k, OutputIt out) {
+    using D = decltype(distance(*first, point));
+
+    const size_t n = static_cast<size_t>(std::distance(first, last));
+    detail::NearestHeap<D> heap(std::min(k, n));
+    for (size_t i = 0; i < n; ++i) {
+        heap.push(distance(first[i], point), i);
+    }
+    return heap.pop_sorted(out);
+}
+
+/**
+ * Indices of all points within radius of point by increasing distance (ties by index),
+ * written to out. Brute force in O(N + m log m) for m results; the results are collected and
+ * sorted in a vector allocated per call.
+ */
+template<typename RandomIt, typename OutputIt>
+OutputIt find_within_radius_idx(RandomIt first, RandomIt last, const Point2<track_value_t<RandomIt>>& point, track_value_t<RandomIt> radius, OutputIt out) {
+    using D = decltype(distance(*first, point));
+
+    const size_t n = static_cast<size_t>(std::distance(first, last));
+    std::vector<std::pair<D, size_t>> found;
+    for (size_t i = 0; i < n; ++i) {
+        D dist = distance(first[i], point);
+        if (dist <= radius) {
+            found.emplace_back(dist, i);
+        }
+    }
+    std::sort(found.begin(), found.end());
+    for (const auto& item : found) {
+        *out++ = item.second;
+    }
+    return out;
+}
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_ALGORITHM_HPP
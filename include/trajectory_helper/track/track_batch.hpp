@@ -0,0 +1,204 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_BATCH_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_BATCH_HPP
+
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include "trajectory_helper/instrumentation.hpp"
+#include "trajectory_helper/math_kernels.hpp"
+#include "trajectory_helper/track/track.hpp"
+#include "trajectory_helper/track/track_algorithm.hpp"
+
+namespace th {
+
+namespace detail {
+
+/**
+ * Calls fn(i) for every track index in [0, n), in parallel when OpenMP is enabled
+ * (see the TRAJECTORY_HELPER_OPENMP CMake option). Once all calls have finished, the exception
+ * of the lowest failing index is rethrown, so the error does not depend on thread timing.
+ */
+template<typename Fn>
+void for_each_track(size_t n, Fn&& fn) {
+    std::exception_ptr error;
+    long long error_idx = -1;
+    const long long count = static_cast<long long>(n);
+#ifdef _OPENMP
+    #pragma omp parallel for schedule(dynamic, 16)
+#endif
+    for (long long i = 0; i < count; ++i) {
+        try {
+            fn(static_cast<size_t>(i));
+        } catch (...) {
+#ifdef _OPENMP
+            #pragma omp critical(th_for_each_track)
+#endif
+            if (error_idx < 0 || i < error_idx) {
+                error = std::current_exception();
+                error_idx = i;
+            }
+        }
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Many tracks stored back to back in one contiguous point buffer.
+ *
+ * Track i occupies points [offset(i), offset(i + 1)). Batched kernels run the shared track
+ * algorithms on every track, in parallel across tracks when OpenMP is enabled; within a track
+ * they run the same code as Track2. Meant for planners evaluating thousands of
+ * short candidate tracks per cycle: a batch is reused across cycles with clear(), which keeps
+ * the capacity, so steady state processing does not allocate.
+ */
+template<typename T>
+class TrackBatch2 {
+public:
+    TrackBatch2() : offsets_(1, 0) {}
+
+    void reserve(size_t num_tracks, size_t num_points) {
+        offsets_.reserve(num_tracks + 1);
+        points_.reserve(num_points);
+    }
+
+    // Removes all tracks, keeping the capacity
+    void clear() {
+        points_.clear();
+        offsets_.resize(1);
+    }
+
+    // Appends a track and returns its index
+    template<typename InputIt>
+    size_t add_track(InputIt first, InputIt last) {
+        for (; first != last; ++first) {
+            points_.push_back(TrackPoint2<T>(*first));
+        }
+        offsets_.push_back(points_.size());
+        return size() - 1;
+    }
+
+    template<typename Allocator>
+    size_t add_track(const Track2<T, Allocator>& track) {
+        return add_track(track.begin(), track.end());
+    }
+
+    // Appends a track of n default points to be filled in place and returns its index
+    size_t add_track(size_t n) {
+        points_.resize(points_.size() + n);
+        offsets_.push_back(points_.size());
+        return size() - 1;
+    }
+
+    // Number of tracks
+    size_t size() const { return offsets_.size() - 1; }
+    bool empty() const { return size() == 0; }
+    size_t num_points() const { return points_.size(); }
+
+    size_t offset(size_t i) const { return offsets_[i]; }
+    size_t track_size(size_t i) const { return offsets_[i + 1] - offsets_[i]; }
+
+    TrackPoint2<T>* begin(size_t i) { return points_.data() + offsets_[i]; }
+    TrackPoint2<T>* end(size_t i) { return points_.data() + offsets_[i + 1]; }
+    const TrackPoint2<T>* begin(size_t i) const { return points_.data() + offsets_[i]; }
+    const TrackPoint2<T>* end(size_t i) const { return points_.data() + offsets_[i + 1]; }
+
+    const std::vector<TrackPoint2<T>>& points() const { return points_; }
+    const std::vector<size_t>& offsets() const { return offsets_; }
+
+    Track2<T> track(size_t i) const {
+        return Track2<T>(std::vector<TrackPoint2<T>>(begin(i), end(i)));
+    }
+
+    /**
+     * Calculates s, psi and kappa of every track (see Track2::calculate)
+     */
+    template<typename Math = StdMath>
+    void calculate(
+        bool is_closed = true,
+        double stepsize_psi_preview = 1.0,
+        double stepsize_psi_review = 1.0,
+        double stepsize_curv_preview = 1.0,
+        double stepsize_curv_review = 1.0,
+        bool calc_curv = true)
+    {
+        TH_INSTRUMENT(Calculate, num_points());
+        detail::for_each_track(size(), [&](size_t i) {
+            calculate_track<Math>(begin(i), end(i), is_closed,
+                stepsize_psi_preview, stepsize_psi_review,
+                stepsize_curv_preview, stepsize_curv_review, calc_curv);
+        });
+    }
+
+    /**
+     * Interpolates every track at the same s values. The result of track i at s_first[k] is
+     * written to out[i * count + k], count being the number of s values.
+     */
+    template<typename RandomInputIt, typename RandomOutputIt>
+    RandomOutputIt interpolate(RandomInputIt s_first, RandomInputIt s_last, RandomOutputIt out, bool is_closed = true) const {
+        const size_t count = static_cast<size_t>(std::distance(s_first, s_last));
+        TH_INSTRUMENT(Interpolate, count * size());
+        detail::for_each_track(size(), [&](size_t i) {
+            interpolate_track_points(begin(i), end(i), s_first, s_last, out + i * count, is_closed);
+        });
+        return out + size() * count;
+    }
+
+    /**
+     * Resamples every track with the given stepsize into out and calculates the results.
+     * out must be a different batch than *this; its capacity is reused.
+     */
+    void interpolate_track(T stepsize, TrackBatch2& out, bool is_closed = true) const {
+        TH_INSTRUMENT(InterpolateTrack, num_points());
+
+        // Sizes first, so every track can be resampled in place and in parallel. They are
+        // staged behind the current offsets of out, which stays unchanged if a track is invalid.
+        const size_t staged = out.offsets_.size();
+        try {
+            for (size_t i = 0; i < size(); ++i) {
+                size_t n_points = resample_size(begin(i), end(i), stepsize, is_closed);
+                if (n_points < 2) {
+                    throw std::runtime_error("Track must have at least 2 points!");
+                }
+                out.offsets_.push_back(n_points);
+            }
+        } catch (...) {
+            out.offsets_.resize(staged);
+            throw;
+        }
+        out.points_.clear();
+        out.offsets_.erase(out.offsets_.begin() + 1, out.offsets_.begin() + staged);
+        for (size_t i = 1; i < out.offsets_.size(); ++i) {
+            out.offsets_[i] += out.offsets_[i - 1];
+        }
+        out.points_.resize(out.offsets_.back());
+
+        detail::for_each_track(size(), [&](size_t i) {
+            resample_track(begin(i), end(i), stepsize, out.begin(i), is_closed);
+            calculate_track(out.begin(i), out.end(i), is_closed);
+        });
+    }
+
+    TrackBatch2 interpolate_track(T stepsize, bool is_closed = true) const {
+        TrackBatch2 new_batch;
+        interpolate_track(stepsize, new_batch, is_closed);
+        return new_batch;
+    }
+
+private:
+    std::vector<TrackPoint2<T>> points_;
+    std::vector<size_t> offsets_;
+};
+
+typedef TrackBatch2<float> TrackBatch2f;
+typedef TrackBatch2<double> TrackBatch2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_BATCH_HPP
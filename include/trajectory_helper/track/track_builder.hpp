@@ -0,0 +1,187 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_BUILDER_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_BUILDER_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#include "trajectory_helper/utils.hpp"
+#include "trajectory_helper/point/point.hpp"
+#include "trajectory_helper/spatial/grid_index.hpp"
+#include "trajectory_helper/track/track.hpp"
+
+namespace th {
+
+/**
+ * Append-only track builder for points arriving one at a time, e.g. a centerline mapped live.
+ *
+ * Every append extends s by one element and finalizes psi of the point whose preview window
+ * just filled, and kappa of the point whose psi windows are final, in O(1). The windows are
+ * given in index steps; with the same steps the result equals Track2::calculate (open, or
+ * closed after close_loop()), bit for bit. A grid index over the points is updated with every
+ * append. close_loop() recomputes only the points around the seam.
+ */
+template<typename T>
+class TrackBuilder2 {
+public:
+    explicit TrackBuilder2(
+        size_t psi_preview = 1,
+        size_t psi_review = 1,
+        size_t curv_preview = 1,
+        size_t curv_review = 1,
+        T cell_size = T(1))
+    : psi_preview_(std::max<size_t>(psi_preview, 1)), psi_review_(std::max<size_t>(psi_review, 1)),
+      curv_preview_(std::max<size_t>(curv_preview, 1)), curv_review_(std::max<size_t>(curv_review, 1)),
+      grid_(cell_size)
+    {}
+
+    void reserve(size_t n) { track_.reserve(n); }
+
+    /**
+     * Appends a point (x, y, wl, wr are kept; s, psi and kappa are derived)
+     */
+    void append(const TrackPoint2<T>& point) {
+        if (is_closed_) {
+            throw std::runtime_error("Cannot append to a closed track.");
+        }
+        TrackPoint2<T> p(point.x, point.y, point.wl, point.wr);
+        const size_t n = track_.size() + 1;
+        p.s = n == 1 ? T() : track_.back().s + distance(track_.back(), p);
+        track_.push_back(p);
+        grid_.insert(n - 1, p.to_point());
+
+        if (n > psi_preview_) {
+            size_t i = n - 1 - psi_preview_;
+            heading(track_, i, i + psi_preview_, i > psi_review_ ? i - psi_review_ : 0);
+        }
+        if (n > psi_preview_ + curv_preview_) {
+            size_t i = n - 1 - psi_preview_ - curv_preview_;
+            curvature(track_, i, i + curv_preview_, i > curv_review_ ? i - curv_review_ : 0, T());
+        }
+    }
+
+    void append(const Point2<T>& point) { append(TrackPoint2<T>(point)); }
+
+    size_t size() const { return track_.size(); }
+    bool is_closed() const { return is_closed_; }
+
+    // Number of leading points whose s, psi and kappa are final
+    size_t num_finalized() const {
+        if (is_closed_) return track_.size();
+        const size_t pending = psi_preview_ + curv_preview_;
+        return track_.size() > pending ? track_.size() - pending : 0;
+    }
+
+    // Points built so far; psi and kappa are valid for the first num_finalized() points
+    const Track2<T>& track() const { return track_; }
+
+    const GridIndex2<T>& grid() const { return grid_; }
+
+    /**
+     * Copy of the track with the pending tail computed with clamped windows, equal to
+     * Track2::calculate(false) with the same index steps
+     */
+    Track2<T> snapshot() const {
+        Track2<T> track = track_;
+        const size_t n = track.size();
+        if (is_closed_ || n < 2) return track;
+
+        for (size_t i = n > psi_preview_ ? n - psi_preview_ : 0; i < n; ++i) {
+            heading(track, i, std::min(i + psi_preview_, n - 1), i > psi_review_ ? i - psi_review_ : 0);
+        }
+        const size_t pending = psi_preview_ + curv_preview_;
+        for (size_t i = n > pending ? n - pending : 0; i < n; ++i) {
+            curvature(track, i, std::min(i + curv_preview_, n - 1), i > curv_review_ ? i - curv_review_ : 0, T());
+        }
+        return track;
+    }
+
+    /**
+     * Closes the loop from the last point back to the first and recomputes the points whose
+     * windows cross the seam, equal to Track2::calculate(true) with the same index steps
+     */
+    void close_loop() {
+        if (is_closed_) return;
+        const size_t n = track_.size();
+        if (n < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+        is_closed_ = true;
+        const T total_length = track_[n - 1].s + distance(track_[n - 1], track_[0]);
+
+        auto seam_heading = [&](size_t i) {
+            heading(track_, i, (i + psi_preview_) % n, (i + n - psi_review_ % n) % n);
+        };
+        auto seam_curvature = [&](size_t i) {
+            curvature(track_, i, (i + curv_preview_) % n, (i + n - curv_review_ % n) % n, total_length);
+        };
+
+        for (size_t i = 0; i < std::min(psi_review_, n); ++i) seam_heading(i);
+        for (size_t i = n > psi_preview_ ? n - psi_preview_ : 0; i < n; ++i) seam_heading(i);
+
+        const size_t head = std::min(psi_review_ + curv_review_, n);
+        const size_t pending = psi_preview_ + curv_preview_;
+        for (size_t i = 0; i < head; ++i) seam_curvature(i);
+        for (size_t i = std::max(n > pending ? n - pending : 0, head); i < n; ++i) seam_curvature(i);
+    }
+
+    /**
+     * Index of the point closest to point, searched on the grid
+     */
+    size_t find_nearest_idx(const Point2<T>& point) const {
+        if (track_.empty()) return 0;
+        using D = decltype(distance(track_[0], point));
+        D best = std::numeric_limits<D>::max();
+        size_t nearest = 0;
+
+        const std::int64_t cx = grid_.cell_coord(point.x);
+        const std::int64_t cy = grid_.cell_coord(point.y);
+        auto consider = [&](size_t i) {
+            D dist = distance(track_[i], point);
+            if (dist < best || (dist == best && i < nearest)) {
+                best = dist;
+                nearest = i;
+            }
+        };
+        const bool searched = grid_.for_each_ring(cx, cy, consider, [&](std::int64_t ring) {
+            return best < static_cast<D>(ring) * static_cast<D>(grid_.cell_size());
+        });
+        if (!searched) {
+            for (size_t i = 0; i < track_.size(); ++i) consider(i);
+        }
+        return nearest;
+    }
+
+private:
+    static void heading(Track2<T>& track, size_t i, size_t preview_idx, size_t review_idx) {
+        T dx = track[preview_idx].x - track[review_idx].x;
+        T dy = track[preview_idx].y - track[review_idx].y;
+        track[i].psi = normalize_psi(std::atan2(dy, dx));
+    }
+
+    // total_length is only used when the window crosses the seam of a closed track
+    static void curvature(Track2<T>& track, size_t i, size_t preview_idx, size_t review_idx, T total_length) {
+        T delta_psi = angle_diff(track[preview_idx].psi, track[review_idx].psi);
+        T path_length = review_idx < preview_idx
+            ? track[preview_idx].s - track[review_idx].s
+            : total_length - track[review_idx].s + track[preview_idx].s;
+        track[i].kappa = delta_psi / path_length;
+    }
+
+    size_t psi_preview_;
+    size_t psi_review_;
+    size_t curv_preview_;
+    size_t curv_review_;
+    bool is_closed_ = false;
+    Track2<T> track_;
+    GridIndex2<T> grid_;
+};
+
+typedef TrackBuilder2<float> TrackBuilder2f;
+typedef TrackBuilder2<double> TrackBuilder2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_BUILDER_HPP
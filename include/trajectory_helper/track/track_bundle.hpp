@@ -0,0 +1,187 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_BUNDLE_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_BUNDLE_HPP
+
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "trajectory_helper/utils.hpp"
+#include "trajectory_helper/point/point.hpp"
+#include "trajectory_helper/track/track.hpp"
+#include "trajectory_helper/track/track_algorithm.hpp"
+#include "trajectory_helper/track/track_projector.hpp"
+
+namespace th {
+
+/**
+ * Result of projecting a point onto a TrackBundle2
+ */
+template<typename T>
+struct BundleProjection2 {
+    TrackPoint2<T> reference;           // Projection onto the reference line
+    size_t segment = 0;                 // Reference segment of the projection
+    T offset = T();                     // Signed lateral offset of the point from the reference (left positive)
+    std::vector<TrackPoint2<T>> lines;  // Corresponding point on every line, with the line's own s
+    std::vector<T> line_offsets;        // Signed lateral offset of every line from the reference
+};
+
+/**
+ * Several lines (centerline, raceline, overtaking lines, ...) sharing the station
+ * parameterization of a reference line.
+ *
+ * Every line is aligned to the reference once: point i of an aligned line is the projection
+ * of reference point i onto that line. A query then searches the reference only and reads
+ * all lines off the same segment and projection parameter. Cold queries go through a
+ * TrackProjector2 over the reference; the aligned lines use the allocator of the reference.
+ */
+template<typename T, typename Allocator = std::allocator<TrackPoint2<T>>>
+class TrackBundle2 {
+public:
+    using track_type = Track2<T, Allocator>;
+    using point_vector_type = typename track_type::point_vector_type;
+    using column_type = typename track_type::column_type;
+
+    /**
+     * align_window bounds the search of every aligned point around the previous one; the
+     * alignment follows the line beyond it when the line is denser than the reference
+     */
+    explicit TrackBundle2(track_type reference, bool is_closed = true, size_t align_window = 16)
+    : reference_(prepare(std::move(reference), is_closed)), is_closed_(is_closed), align_window_(align_window),
+      projector_(reference_, is_closed)
+    {}
+
+    // The projector points into the reference, so a copy gets its own
+    TrackBundle2(const TrackBundle2& other)
+    : reference_(other.reference_), is_closed_(other.is_closed_), align_window_(other.align_window_),
+      projector_(reference_, is_closed_), lines_(other.lines_), line_offsets_(other.line_offsets_),
+      line_lengths_(other.line_lengths_)
+    {}
+
+    TrackBundle2(TrackBundle2&&) = default;
+    TrackBundle2& operator=(const TrackBundle2&) = delete;
+    TrackBundle2& operator=(TrackBundle2&&) = delete;
+
+    /**
+     * Aligns line to the reference and adds it to the bundle; returns its index
+     */
+    template<typename LineAllocator>
+    size_t add_line(const Track2<T, LineAllocator>& line) {
+        if (line.size() < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+
+        const size_t n = reference_.size();
+        point_vector_type aligned(reference_.get_allocator());
+        column_type offsets(reference_.get_allocator());
+        aligned.reserve(n);
+        offsets.reserve(n);
+
+        // Sweep along the reference; every projection warm-starts the next one
+        SegmentSweep sweep;
+        for (size_t i = 0; i < n; ++i) {
+            const auto& r = reference_[i];
+            auto projection = sweep_segment_projection(line.begin(), line.end(), r.to_point(), sweep, align_window_, is_closed_);
+            aligned.push_back(segment_projection_point(line.begin(), line.end(), projection));
+            offsets.push_back(lateral_offset(r, projection.point));
+        }
+
+        lines_.push_back(std::move(aligned));
+        line_offsets_.push_back(std::move(offsets));
+        line_lengths_.push_back(line.has_s() ? track_length(line.begin(), line.end(), is_closed_) : T());
+        return lines_.size() - 1;
+    }
+
+    size_t num_lines() const { return lines_.size(); }
+    bool is_closed() const { return is_closed_; }
+    const track_type& reference() const { return reference_; }
+    const point_vector_type& aligned_line(size_t line) const { return lines_.at(line); }
+
+    // Signed lateral offset of a line from reference point idx
+    T line_offset(size_t line, size_t idx) const { return line_offsets_.at(line).at(idx); }
+
+    BundleProjection2<T> project(const Point2<T>& point) const {
+        BundleProjection2<T> result;
+        project(point, result);
+        return result;
+    }
+
+    // Projection into a reusable result
+    void project(const Point2<T>& point, BundleProjection2<T>& out) const {
+        fill(point, projector_.project_segment(point), out);
+    }
+
+    // Warm-started projection searching the reference within +-window of hint_idx
+    void project(const Point2<T>& point, size_t hint_idx, size_t window, BundleProjection2<T>& out) const {
+        const size_t n = reference_.size();
+        auto range = segment_search_range(is_closed_ ? n : n - 1, hint_idx, window, is_closed_);
+        fill(point, find_segment_projection(reference_.begin(), reference_.end(), point, range.first, range.second, is_closed_), out);
+    }
+
+private:
+    static track_type prepare(track_type reference, bool is_closed) {
+        if (reference.size() < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+        if (!reference.has_s() || !reference.has_psi()) {
+            reference.calculate(is_closed);
+        }
+        return reference;
+    }
+
+    // Signed distance of point from r along the left normal of r
+    static T lateral_offset(const TrackPoint2<T>& r, const Point2<T>& point) {
+        return (point.y - r.y) * std::cos(r.psi) - (point.x - r.x) * std::sin(r.psi);
+    }
+
+    void fill(const Point2<T>& point, const SegmentProjection<T>& projection, BundleProjection2<T>& out) const {
+        const size_t n = reference_.size();
+        const size_t i1 = projection.segment;
+        const size_t i2 = (i1 + 1) % n;
+        const T t = projection.t;
+
+        out.reference = segment_projection_point(reference_.begin(), reference_.end(), projection);
+        out.segment = i1;
+        out.offset = lateral_offset(out.reference, point);
+
+        out.lines.resize(lines_.size());
+        out.line_offsets.resize(lines_.size());
+        for (size_t j = 0; j < lines_.size(); ++j) {
+            const auto& p1 = lines_[j][i1];
+            const auto& p2 = lines_[j][i2];
+            TrackPoint2<T>& p = out.lines[j];
+
+            p.x = p1.x + t * (p2.x - p1.x);
+            p.y = p1.y + t * (p2.y - p1.y);
+            p.psi = normalize_psi(p1.psi + t * angle_diff(p2.psi, p1.psi));
+            p.kappa = p1.kappa + t * (p2.kappa - p1.kappa);
+            p.wl = p1.wl + t * (p2.wl - p1.wl);
+            p.wr = p1.wr + t * (p2.wr - p1.wr);
+
+            // The line's own s may wrap between two aligned points
+            T s2 = p2.s < p1.s && line_lengths_[j] > T() ? p2.s + line_lengths_[j] : p2.s;
+            p.s = p1.s + t * (s2 - p1.s);
+            if (line_lengths_[j] > T() && p.s >= line_lengths_[j]) {
+                p.s -= line_lengths_[j];
+            }
+
+            out.line_offsets[j] = line_offsets_[j][i1] + t * (line_offsets_[j][i2] - line_offsets_[j][i1]);
+        }
+    }
+
+    track_type reference_;
+    bool is_closed_;
+    size_t align_window_;
+    TrackProjector2<T> projector_;
+    std::vector<point_vector_type> lines_;
+    std::vector<column_type> line_offsets_;
+    std::vector<T> line_lengths_;
+};
+
+typedef TrackBundle2<float> TrackBundle2f;
+typedef TrackBundle2<double> TrackBundle2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_BUNDLE_HPP
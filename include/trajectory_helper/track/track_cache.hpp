@@ -0,0 +1,304 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_CACHE_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_CACHE_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include "trajectory_helper/track/track.hpp"
+
+namespace th {
+
+/**
+ * Persistent cache of derived track data in binary sidecar files.
+ *
+ * An entry is keyed by an FNV-1a hash of the input points, the parameters that derived it and
+ * kAlgorithmVersion.
+ * The file holds a fixed header (magic, format version, scalar size, key, point count)
+ * followed by the raw TrackPoint2 array, so a hit costs a single bulk read into the track
+ * buffer. Files use the native byte order and are not meant to move between platforms;
+ * any mismatch or a payload of the wrong length counts as a miss. Files are written to a
+ * temporary file and renamed into place, so readers never see a partially written entry.
+ */
+namespace cache {
+
+constexpr char kMagic[4] = {'T', 'H', 'T', 'C'};
+constexpr std::uint32_t kVersion = 1;
+
+// Version of the derived results, hashed into every key. Bump it whenever calculate or
+// interpolate_track change the values they produce, so entries of older builds become misses.
+constexpr std::uint32_t kAlgorithmVersion = 1;
+
+constexpr std::uint64_t kFnvOffset = 14695981039346656037ull;
+constexpr std::uint64_t kFnvPrime = 1099511628211ull;
+
+inline std::uint64_t fnv1a(const void* data, size_t size, std::uint64_t hash = kFnvOffset) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= bytes[i];
+        hash *= kFnvPrime;
+    }
+    return hash;
+}
+
+template<typename V>
+std::uint64_t fnv1a_value(const V& value, std::uint64_t hash) {
+    static_assert(std::is_trivially_copyable<V>::value, "Only trivially copyable values can be hashed.");
+    return fnv1a(&value, sizeof(V), hash);
+}
+
+/**
+ * Hashes the point geometry (x, y, wl, wr) of a track; derived columns are ignored
+ */
+template<typename T, typename Allocator>
+std::uint64_t hash_geometry(const Track2<T, Allocator>& track, std::uint64_t hash = kFnvOffset) {
+    hash = fnv1a_value(static_cast<std::uint64_t>(sizeof(T)), hash);
+    hash = fnv1a_value(static_cast<std::uint64_t>(track.size()), hash);
+    for (const auto& p : track) {
+        hash = fnv1a_value(p.x, hash);
+        hash = fnv1a_value(p.y, hash);
+        hash = fnv1a_value(p.wl, hash);
+        hash = fnv1a_value(p.wr, hash);
+    }
+    return hash;
+}
+
+/**
+ * Hashes all columns of a track
+ */
+template<typename T, typename Allocator>
+std::uint64_t hash_points(const Track2<T, Allocator>& track, std::uint64_t hash = kFnvOffset) {
+    static_assert(std::is_trivially_copyable<TrackPoint2<T>>::value, "TrackPoint2 must be trivially copyable.");
+    hash = fnv1a_value(static_cast<std::uint64_t>(sizeof(T)), hash);
+    hash = fnv1a_value(static_cast<std::uint64_t>(track.size()), hash);
+    return fnv1a(track.data(), track.size() * sizeof(TrackPoint2<T>), hash);
+}
+
+/**
+ * Whether two tracks have bitwise identical geometry (x, y, wl, wr), the columns hash_geometry
+ * covers
+ */
+template<typename T, typename Allocator, typename OtherAllocator>
+bool same_geometry(const Track2<T, Allocator>& a, const Track2<T, OtherAllocator>& b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); ++i) {
+        const T lhs[4] = {a[i].x, a[i].y, a[i].wl, a[i].wr};
+        const T rhs[4] = {b[i].x, b[i].y, b[i].wl, b[i].wr};
+        if (std::memcmp(lhs, rhs, sizeof(lhs)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+struct Header {
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t scalar_size;
+    std::uint32_t point_size;
+    std::uint64_t key;
+    std::uint64_t size;
+};
+
+/**
+ * Loads the track stored under key into out; returns false on a miss
+ */
+template<typename T, typename Allocator>
+bool load(const std::string& path, std::uint64_t key, Track2<T, Allocator>& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+
+    Header header;
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(Header))
+        || std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0
+        || header.version != kVersion
+        || header.scalar_size != sizeof(T)
+        || header.point_size != sizeof(TrackPoint2<T>)
+        || header.key != key) {
+        return false;
+    }
+
+    // The payload must hold exactly header.size points; checked before sizing out, so a corrupt
+    // count cannot trigger a huge allocation
+    const std::streampos payload = file.tellg();
+    file.seekg(0, std::ios::end);
+    const std::streamoff remaining = file.tellg() - payload;
+    file.seekg(payload);
+    if (!file || remaining < 0
+        || header.size > std::numeric_limits<size_t>::max() / sizeof(TrackPoint2<T>)
+        || static_cast<std::uint64_t>(remaining) != header.size * sizeof(TrackPoint2<T>)) {
+        out.clear();
+        return false;
+    }
+
+    out.resize(static_cast<size_t>(header.size));
+    const std::streamsize bytes = static_cast<std::streamsize>(out.size() * sizeof(TrackPoint2<T>));
+    if (!file.read(reinterpret_cast<char*>(out.data()), bytes)) {
+        out.clear();
+        return false;
+    }
+    return true;
+}
+
+namespace detail {
+
+// Temporary file next to path, unique per process, thread and call
+inline std::string temporary_path(const std::string& path) {
+    static std::atomic<std::uint64_t> counter{0};
+    std::uint64_t tag = fnv1a_value(static_cast<std::int64_t>(std::chrono::steady_clock::now().time_since_epoch().count()), kFnvOffset);
+    tag = fnv1a_value(static_cast<std::uint64_t>(std::hash<std::thread::id>()(std::this_thread::get_id())), tag);
+    tag = fnv1a_value(counter.fetch_add(1), tag);
+    return path + ".tmp" + std::to_string(tag);
+}
+
+}  // namespace detail
+
+/**
+ * Stores track under key, replacing the file; returns false if the file could not be written
+ */
+template<typename T, typename Allocator>
+bool try_save(const std::string& path, std::uint64_t key, const Track2<T, Allocator>& track) {
+    static_assert(std::is_trivially_copyable<TrackPoint2<T>>::value, "TrackPoint2 must be trivially copyable.");
+
+    Header header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.scalar_size = sizeof(T);
+    header.point_size = sizeof(TrackPoint2<T>);
+    header.key = key;
+    header.size = track.size();
+
+    const std::string temporary = detail::temporary_path(path);
+    {
+        std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        file.write(reinterpret_cast<const char*>(track.data()), static_cast<std::streamsize>(track.size() * sizeof(TrackPoint2<T>)));
+        file.close();
+        if (!file) {
+            std::remove(temporary.c_str());
+            return false;
+        }
+    }
+
+    // rename does not replace an existing file on every platform (Windows)
+    if (std::rename(temporary.c_str(), path.c_str()) != 0
+        && (std::remove(path.c_str()) != 0 || std::rename(temporary.c_str(), path.c_str()) != 0)) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+    return true;
+}
+
+/**
+ * Stores track under key, replacing the file; throws if the file could not be written
+ */
+template<typename T, typename Allocator>
+void save(const std::string& path, std::uint64_t key, const Track2<T, Allocator>& track) {
+    if (!try_save(path, key, track)) {
+        throw std::runtime_error("Failed to write track cache file: " + path);
+    }
+}
+
+/**
+ * Key of Track2::calculate on track with the given parameters
+ */
+template<typename T, typename Allocator>
+std::uint64_t calculate_key(
+    const Track2<T, Allocator>& track,
+    bool is_closed,
+    double stepsize_psi_preview,
+    double stepsize_psi_review,
+    double stepsize_curv_preview,
+    double stepsize_curv_review,
+    bool calc_curv)
+{
+    std::uint64_t hash = fnv1a("calculate", 9);
+    hash = fnv1a_value(kAlgorithmVersion, hash);
+    hash = hash_geometry(track, hash);
+    hash = fnv1a_value(is_closed, hash);
+    hash = fnv1a_value(stepsize_psi_preview, hash);
+    hash = fnv1a_value(stepsize_psi_review, hash);
+    hash = fnv1a_value(stepsize_curv_preview, hash);
+    hash = fnv1a_value(stepsize_curv_review, hash);
+    return fnv1a_value(calc_curv, hash);
+}
+
+/**
+ * Key of Track2::interpolate_track on track with the given parameters
+ */
+template<typename T, typename Allocator>
+std::uint64_t interpolate_track_key(const Track2<T, Allocator>& track, T stepsize, bool is_closed) {
+    std::uint64_t hash = fnv1a("interpolate_track", 17);
+    hash = fnv1a_value(kAlgorithmVersion, hash);
+    hash = hash_points(track, hash);
+    hash = fnv1a_value(stepsize, hash);
+    return fnv1a_value(is_closed, hash);
+}
+
+}  // namespace cache
+
+/**
+ * Track2::calculate backed by the cache file at path. On a hit the derived columns are loaded
+ * instead of recalculated; on a miss the track is calculated and the file is written. An entry
+ * whose geometry differs from track (a key collision) is a miss, and a file that cannot be
+ * written only means the result is not cached. Returns true on a hit.
+ */
+template<typename T, typename Allocator>
+bool calculate_cached(
+    Track2<T, Allocator>& track,
+    const std::string& path,
+    bool is_closed = true,
+    double stepsize_psi_preview = 1.0,
+    double stepsize_psi_review = 1.0,
+    double stepsize_curv_preview = 1.0,
+    double stepsize_curv_review = 1.0,
+    bool calc_curv = true)
+{
+    const std::uint64_t key = cache::calculate_key(track, is_closed,
+        stepsize_psi_preview, stepsize_psi_review, stepsize_curv_preview, stepsize_curv_review, calc_curv);
+    Track2<T, Allocator> cached(track.get_allocator());
+    if (cache::load(path, key, cached) && cache::same_geometry(cached, track)) {
+        track.swap(cached);
+        return true;
+    }
+
+    track.calculate(is_closed, stepsize_psi_preview, stepsize_psi_review,
+        stepsize_curv_preview, stepsize_curv_review, calc_curv);
+    cache::try_save(path, key, track);
+    return false;
+}
+
+/**
+ * Track2::interpolate_track backed by the cache file at path (see calculate_cached); returns
+ * true on a hit
+ */
+template<typename T, typename Allocator, typename OutAllocator>
+bool interpolate_track_cached(
+    const Track2<T, Allocator>& track, T stepsize, Track2<T, OutAllocator>& out, const std::string& path, bool is_closed = true)
+{
+    const std::uint64_t key = cache::interpolate_track_key(track, stepsize, is_closed);
+    if (cache::load(path, key, out)) {
+        return true;
+    }
+
+    track.interpolate_track(stepsize, out, is_closed);
+    cache::try_save(path, key, out);
+    return false;
+}
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_CACHE_HPP
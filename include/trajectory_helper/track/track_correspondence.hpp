@@ -0,0 +1,143 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_CORRESPONDENCE_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_CORRESPONDENCE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include "trajectory_helper/utils.hpp"
+#include "trajectory_helper/track/track.hpp"
+#include "trajectory_helper/track/track_algorithm.hpp"
+
+namespace th {
+
+/**
+ * s→s lookup table between two tracks, e.g. centerline and raceline.
+ *
+ * Built by sweeping along the source track and projecting every source point onto the target
+ * with a search warm-started at the previous match (sweep_segment_projection), so the table
+ * costs O(N · window) instead of O(N · M) as long as the target is not much denser than the
+ * source. On closed tracks the target s is unwrapped to increase monotonically over one
+ * source lap; mapped values are wrapped back into the target lap.
+ */
+template<typename T>
+class TrackCorrespondence2 {
+public:
+    template<typename SourceAllocator, typename TargetAllocator>
+    TrackCorrespondence2(
+        const Track2<T, SourceAllocator>& source,
+        const Track2<T, TargetAllocator>& target,
+        bool is_closed = true,
+        size_t window = 16)
+    : is_closed_(is_closed)
+    {
+        if (source.size() < 2 || target.size() < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+        if (!source.has_s() || !target.has_s()) {
+            throw std::runtime_error("Track must have s values! Call calculate() first.");
+        }
+
+        const size_t n = source.size();
+        target_s_min_ = target.front().s;
+        target_length_ = track_length(target.begin(), target.end(), is_closed);
+        source_s_.reserve(n + 1);
+        target_s_.reserve(n + 1);
+
+        SegmentSweep sweep;
+        T lap_offset = T();
+        T prev_s = T();
+        for (size_t i = 0; i < n; ++i) {
+            auto projection = sweep_segment_projection(target.begin(), target.end(), source[i].to_point(), sweep, window, is_closed);
+            T s = segment_projection_point(target.begin(), target.end(), projection).s;
+
+            // Unwrap jumps across the target seam
+            if (is_closed && i > 0) {
+                if (s - prev_s < -T(0.5) * target_length_) {
+                    lap_offset += target_length_;
+                } else if (s - prev_s > T(0.5) * target_length_) {
+                    lap_offset -= target_length_;
+                }
+            }
+            prev_s = s;
+            source_s_.push_back(source[i].s);
+            target_s_.push_back(s + lap_offset);
+        }
+
+        // The closing segment maps onto the start of the next target lap
+        if (is_closed) {
+            source_s_.push_back(track_length(source.begin(), source.end(), true));
+            target_s_.push_back(target_s_.front() + target_length_);
+        }
+    }
+
+    size_t size() const { return source_s_.size(); }
+    const std::vector<T>& source_s() const { return source_s_; }
+    const std::vector<T>& target_s() const { return target_s_; }
+
+    /**
+     * Target s matching source s (O(log N))
+     * Closed tracks accept any s; open tracks clamp s to the source range.
+     */
+    T map(T s) const {
+        s = wrap_source(s);
+        size_t idx = static_cast<size_t>(std::distance(source_s_.begin(),
+            std::upper_bound(source_s_.begin(), source_s_.end(), s)));
+        return map_segment(idx > 0 ? idx - 1 : 0, s);
+    }
+
+    /**
+     * Maps a range of source s values; increasing queries advance a cursor in O(1) amortized
+     */
+    template<typename InputIt, typename OutputIt>
+    OutputIt map(InputIt first, InputIt last, OutputIt out) const {
+        size_t idx = 0;
+        for (; first != last; ++first) {
+            T s = wrap_source(static_cast<T>(*first));
+            if (s < source_s_[idx]) {
+                idx = static_cast<size_t>(std::distance(source_s_.begin(),
+                    std::upper_bound(source_s_.begin(), source_s_.end(), s)));
+                idx = idx > 0 ? idx - 1 : 0;
+            }
+            while (idx + 2 < source_s_.size() && source_s_[idx + 1] <= s) ++idx;
+            *out++ = map_segment(idx, s);
+        }
+        return out;
+    }
+
+private:
+    T wrap_source(T s) const {
+        const T s_min = source_s_.front();
+        const T s_max = source_s_.back();
+        if (is_closed_) {
+            return wrap_s(s, s_min, s_max - s_min);
+        }
+        return std::clamp(s, s_min, s_max);
+    }
+
+    T map_segment(size_t idx, T s) const {
+        idx = std::min(idx, source_s_.size() - 2);
+        const T ds = source_s_[idx + 1] - source_s_[idx];
+        const T alpha = ds > T(0) ? (s - source_s_[idx]) / ds : T(0);
+        T mapped = target_s_[idx] + alpha * (target_s_[idx + 1] - target_s_[idx]);
+        if (is_closed_) {
+            mapped = wrap_s(mapped, target_s_min_, target_length_);
+        }
+        return mapped;
+    }
+
+    bool is_closed_;
+    T target_s_min_ = T();
+    T target_length_ = T();
+    std::vector<T> source_s_;
+    std::vector<T> target_s_;
+};
+
+typedef TrackCorrespondence2<float> TrackCorrespondence2f;
+typedef TrackCorrespondence2<double> TrackCorrespondence2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_CORRESPONDENCE_HPP
@@ -0,0 +1,185 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_FEASIBILITY_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_FEASIBILITY_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "trajectory_helper/point/point.hpp"
+#include "trajectory_helper/track/track.hpp"
+#include "trajectory_helper/track/track_algorithm.hpp"
+#include "trajectory_helper/track/track_batch.hpp"
+
+namespace th {
+
+/**
+ * Limits of a feasible path. Infinite limits are not checked.
+ */
+template<typename T>
+struct FeasibilityLimits {
+    T kappa_max = std::numeric_limits<T>::infinity();   // Maximum |kappa|
+    T dkappa_max = std::numeric_limits<T>::infinity();  // Maximum |dkappa/ds|
+    T width_margin = T();                               // Minimum distance to the left and right boundaries
+};
+
+/**
+ * Index of the first point violating the curvature, curvature rate or width limits, or -1 if
+ * the path is feasible. Widths are the point's own wl/wr (e.g. as produced by FrenetSampler2);
+ * paths without widths pass the width check. A NaN kappa, s or width is a violation.
+ *
+ * Points are checked in blocks: the block is copied into columns, a branch-free reduction over
+ * the columns tells whether any point violates a limit, and only a violating block is scanned
+ * for the first violation.
+ */
+template<typename RandomIt>
+std::ptrdiff_t first_infeasible_idx(RandomIt first, RandomIt last, const FeasibilityLimits<track_value_t<RandomIt>>& limits) {
+    using T = track_value_t<RandomIt>;
+    constexpr size_t block = detail::kernel_block;
+
+    const size_t n = static_cast<size_t>(std::distance(first, last));
+    if (n == 0) {
+        return -1;
+    }
+    if (!first->has_s() || !first->has_kappa()) {
+        throw std::runtime_error("Track must have s and kappa values! Call calculate() first.");
+    }
+
+    // kappa and s have the previous point in front
+    T kappa[block + 1];
+    T s[block + 1];
+    T wl[block];
+    T wr[block];
+    // Each limit is checked as "not within", so NaN values violate. An unchecked rate limit
+    // becomes the largest finite value: inf times the first point's zero step would be NaN.
+    const T dkappa_max = limits.dkappa_max == std::numeric_limits<T>::infinity() ? std::numeric_limits<T>::max() : limits.dkappa_max;
+    auto violates = [&](size_t k) {
+        return static_cast<int>(!detail::less_equal(std::abs(kappa[k + 1]), limits.kappa_max))
+            | static_cast<int>(!detail::less_equal(limits.width_margin, wl[k]))
+            | static_cast<int>(!detail::less_equal(limits.width_margin, wr[k]))
+            | static_cast<int>(!detail::less_equal(std::abs(kappa[k + 1] - kappa[k]), dkappa_max * (s[k + 1] - s[k])));
+    };
+
+    for (size_t b = 0; b < n; b += block) {
+        const size_t m = std::min(block, n - b);
+        // The first point is its own predecessor: a zero curvature change never violates
+        const auto& prev = first[b > 0 ? b - 1 : 0];
+        kappa[0] = prev.kappa;
+        s[0] = prev.s;
+        for (size_t k = 0; k < m; ++k) {
+            const auto& p = first[b + k];
+            kappa[k + 1] = p.kappa;
+            s[k + 1] = p.s;
+            wl[k] = p.wl;
+            wr[k] = p.wr;
+        }
+
+        int bad = 0;
+        for (size_t k = 0; k < m; ++k) {
+            bad |= violates(k);
+        }
+        if (bad) {
+            for (size_t k = 0; k < m; ++k) {
+                if (violates(k)) return static_cast<std::ptrdiff_t>(b + k);
+            }
+        }
+    }
+    return -1;
+}
+
+/**
+ * Checks every track of a batch (see first_infeasible_idx), writing one index per track to out.
+ * Tracks are processed in parallel when OpenMP is enabled.
+ */
+template<typename T, typename RandomOutputIt>
+RandomOutputIt first_infeasible_idx(const TrackBatch2<T>& batch, const FeasibilityLimits<T>& limits, RandomOutputIt out) {
+    detail::for_each_track(batch.size(), [&](size_t i) {
+        out[i] = first_infeasible_idx(batch.begin(i), batch.end(i), limits);
+    });
+    return out + batch.size();
+}
+
+/**
+ * Feasibility checks of candidate paths against a reference track.
+ *
+ * On top of the limits of first_infeasible_idx, the lateral offset of every candidate point from
+ * the reference must stay within the reference widths (minus the width margin). Points are
+ * projected with a sweep warm-started at the previous point's segment (sweep_segment_projection).
+ * The checker keeps a pointer to the reference points, so the reference must outlive it and
+ * must not be modified or reallocated.
+ */
+template<typename T>
+class FeasibilityChecker2 {
+public:
+    template<typename Allocator>
+    FeasibilityChecker2(const Track2<T, Allocator>& reference, const FeasibilityLimits<T>& limits, bool is_closed = true, size_t window = 8)
+    : points_(reference.data()), size_(reference.size()), limits_(limits), is_closed_(is_closed), window_(window)
+    {
+        if (reference.size() < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+        if (!reference.has_widths()) {
+            throw std::runtime_error("Reference track must have widths.");
+        }
+    }
+
+    const FeasibilityLimits<T>& limits() const { return limits_; }
+
+    // Index of the first infeasible point of the path, or -1
+    template<typename RandomIt>
+    std::ptrdiff_t check(RandomIt first, RandomIt last) const {
+        const std::ptrdiff_t limit_idx = first_infeasible_idx(first, last, limits_);
+        const size_t n = limit_idx < 0 ? static_cast<size_t>(std::distance(first, last)) : static_cast<size_t>(limit_idx);
+        const std::ptrdiff_t offset_idx = first_offset_violation(first, n);
+        return offset_idx < 0 ? limit_idx : offset_idx;
+    }
+
+    // Checks every track of a batch, writing one index per track to out
+    template<typename RandomOutputIt>
+    RandomOutputIt check(const TrackBatch2<T>& batch, RandomOutputIt out) const {
+        detail::for_each_track(batch.size(), [&](size_t i) {
+            out[i] = check(batch.begin(i), batch.end(i));
+        });
+        return out + batch.size();
+    }
+
+private:
+    // First of the points [0, n) leaving the reference widths, or -1
+    template<typename RandomIt>
+    std::ptrdiff_t first_offset_violation(RandomIt first, size_t n) const {
+        SegmentSweep sweep;
+        for (size_t i = 0; i < n; ++i) {
+            const Point2<T> point(first[i].x, first[i].y);
+            auto projection = sweep_segment_projection(points_, points_ + size_, point, sweep, window_, is_closed_);
+
+            // Signed offset, left of the segment positive
+            const auto& p1 = points_[projection.segment];
+            const auto& p2 = points_[(projection.segment + 1) % size_];
+            const T cross = (p2.x - p1.x) * (point.y - p1.y) - (p2.y - p1.y) * (point.x - p1.x);
+            const T d = cross < T(0) ? -projection.distance : projection.distance;
+
+            const T wl = p1.wl + projection.t * (p2.wl - p1.wl);
+            const T wr = p1.wr + projection.t * (p2.wr - p1.wr);
+            if (!(d <= wl - limits_.width_margin && -d <= wr - limits_.width_margin)) {
+                return static_cast<std::ptrdiff_t>(i);
+            }
+        }
+        return -1;
+    }
+
+    const TrackPoint2<T>* points_;
+    size_t size_;
+    FeasibilityLimits<T> limits_;
+    bool is_closed_;
+    size_t window_;
+};
+
+typedef FeasibilityChecker2<float> FeasibilityChecker2f;
+typedef FeasibilityChecker2<double> FeasibilityChecker2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_FEASIBILITY_HPP
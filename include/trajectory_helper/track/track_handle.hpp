@@ -0,0 +1,99 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_HANDLE_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_HANDLE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "trajectory_helper/track/track.hpp"
+
+namespace th {
+
+/**
+ * Publication point for a track shared between a writer (e.g. mapping) and readers
+ * (planning, control), in the style of read-copy-update.
+ *
+ * Readers call load() and keep the returned immutable snapshot for as long as they need a
+ * consistent track. The writer prepares a new track off the hot path (calculate(),
+ * resampling, ...) and publish() swaps it in.
+ *
+ * load() is lock-free: the handle keeps the current and the previous track in two slots, a
+ * reader announces itself on the slot of the version it read, copies the shared_ptr and only
+ * retries if a publication landed in between. publish() takes a mutex to serialize writers
+ * and waits for the few readers still announced on the slot it overwrites, which is the one
+ * new readers no longer pick. A replaced track stays referenced by the handle until the
+ * next publication and is freed by whichever thread drops the last snapshot of it.
+ */
+template<typename T, typename Allocator = std::allocator<TrackPoint2<T>>>
+class TrackHandle2 {
+public:
+    using track_type = Track2<T, Allocator>;
+    using snapshot_type = std::shared_ptr<const track_type>;
+
+    TrackHandle2() = default;
+
+    explicit TrackHandle2(track_type track) {
+        publish(std::move(track));
+    }
+
+    TrackHandle2(const TrackHandle2&) = delete;
+    TrackHandle2& operator=(const TrackHandle2&) = delete;
+
+    // Current snapshot, nullptr until a track has been published
+    snapshot_type load() const {
+        for (;;) {
+            const uint64_t version = version_.load(std::memory_order_seq_cst);
+            Slot& slot = slots_[version & 1];
+            slot.readers.fetch_add(1, std::memory_order_seq_cst);
+            if (version_.load(std::memory_order_seq_cst) == version) {
+                snapshot_type track = slot.track;
+                slot.readers.fetch_sub(1, std::memory_order_release);
+                return track;
+            }
+            slot.readers.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    void publish(track_type track) {
+        publish(std::make_shared<const track_type>(std::move(track)));
+    }
+
+    void publish(snapshot_type track) {
+        std::lock_guard<std::mutex> lock(writer_mutex_);
+        const uint64_t version = version_.load(std::memory_order_relaxed);
+        Slot& next = slots_[(version + 1) & 1];
+        // Readers that still see the old version leave right after their version check
+        while (next.readers.load(std::memory_order_seq_cst) != 0) {
+            std::this_thread::yield();
+        }
+        next.track = std::move(track);
+        version_.store(version + 1, std::memory_order_seq_cst);
+    }
+
+    // Number of publications so far, e.g. to skip work when the track did not change
+    uint64_t version() const { return version_.load(std::memory_order_acquire); }
+
+private:
+    static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<uint64_t>::is_always_lock_free,
+        "TrackHandle2 requires lock-free atomic counters.");
+
+    // Own cache line per slot, so readers of the current track do not contend with the writer
+    struct alignas(64) Slot {
+        snapshot_type track;
+        std::atomic<uint32_t> readers{0};
+    };
+
+    mutable Slot slots_[2];
+    std::atomic<uint64_t> version_{0};
+    std::mutex writer_mutex_;
+};
+
+typedef TrackHandle2<float> TrackHandle2f;
+typedef TrackHandle2<double> TrackHandle2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_HANDLE_HPP
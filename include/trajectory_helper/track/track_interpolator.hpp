@@ -0,0 +1,164 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_INTERPOLATOR_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_INTERPOLATOR_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
+
+#include "trajectory_helper/utils.hpp"
+#include "trajectory_helper/instrumentation.hpp"
+#include "trajectory_helper/track/track.hpp"
+#include "trajectory_helper/track/track_algorithm.hpp"
+
+namespace th {
+
+enum class InterpolationMode {
+    Linear,   // Linear in x, y, psi (wrap-correct) and kappa, like Track2::interpolate
+    Hermite   // Cubic Hermite: x/y with the headings as tangents, psi with the curvatures as tangents
+};
+
+/**
+ * Interpolator over a calculated track with per-segment data precomputed once.
+ *
+ * The wrapped heading change of every segment and the heading directions of every point are
+ * cached, so a Hermite query costs about the same as a linear one: a segment lookup and a few
+ * multiply-adds, no trigonometry. psi is always blended through the wrapped difference and
+ * stays continuous across ±π. Hermite positions follow the stored headings, so the curve
+ * leaves and enters every point along psi, and psi follows the stored curvatures.
+ *
+ * The interpolator keeps a pointer to the track points, so the track must outlive it and must
+ * not be modified or reallocated.
+ */
+template<typename T>
+class TrackInterpolator2 {
+public:
+    template<typename Allocator>
+    explicit TrackInterpolator2(const Track2<T, Allocator>& track, bool is_closed = true, InterpolationMode mode = InterpolationMode::Hermite)
+    : points_(track.data()), size_(track.size()), is_closed_(is_closed), mode_(mode)
+    {
+        if (track.size() < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+        if (!track.has_s() || !track.has_psi() || !track.has_kappa()) {
+            throw std::runtime_error("Track must have s, psi and kappa values! Call calculate() first.");
+        }
+
+        const size_t n_segments = is_closed ? size_ : size_ - 1;
+        s_.resize(n_segments + 1);
+        dpsi_.resize(n_segments);
+        cos_psi_.resize(size_);
+        sin_psi_.resize(size_);
+        for (size_t i = 0; i < size_; ++i) {
+            s_[i] = track[i].s;
+            cos_psi_[i] = std::cos(track[i].psi);
+            sin_psi_[i] = std::sin(track[i].psi);
+        }
+        if (is_closed) {
+            s_[size_] = track_length(track.begin(), track.end(), true);
+        }
+        for (size_t i = 0; i < n_segments; ++i) {
+            dpsi_[i] = angle_diff(track[(i + 1) % size_].psi, track[i].psi);
+        }
+    }
+
+    InterpolationMode mode() const { return mode_; }
+    void set_mode(InterpolationMode mode) { mode_ = mode; }
+
+    /**
+     * Interpolates the track at s_query; closed tracks wrap s, open tracks throw outside
+     * [s_front, s_back] (see Track2::interpolate)
+     */
+    TrackPoint2<T> interpolate(T s_query) const {
+        TH_INSTRUMENT(Interpolate, 1);
+        s_query = check_s(s_query);
+        size_t idx = static_cast<size_t>(std::distance(s_.begin(), std::upper_bound(s_.begin(), s_.end(), s_query)));
+        return interpolate_segment(std::min(idx > 0 ? idx - 1 : 0, s_.size() - 2), s_query);
+    }
+
+    /**
+     * Interpolates every s of [first, last); increasing queries advance a cursor instead of
+     * searching
+     */
+    template<typename InputIt, typename OutputIt>
+    OutputIt interpolate(InputIt first, InputIt last, OutputIt out) const {
+        TH_INSTRUMENT(Interpolate, static_cast<size_t>(std::distance(first, last)));
+        const size_t last_segment = s_.size() - 2;
+        size_t idx = 0;
+        for (; first != last; ++first) {
+            T s_query = check_s(static_cast<T>(*first));
+            if (s_query < s_[idx]) {
+                idx = static_cast<size_t>(std::distance(s_.begin(), std::upper_bound(s_.begin(), s_.end(), s_query)));
+                idx = idx > 0 ? idx - 1 : 0;
+            }
+            while (idx < last_segment && s_[idx + 1] <= s_query) ++idx;
+            *out++ = interpolate_segment(idx, s_query);
+        }
+        return out;
+    }
+
+private:
+    T check_s(T s_query) const {
+        if (is_closed_) {
+            return wrap_s(s_query, s_.front(), s_.back() - s_.front());
+        }
+        if (s_query < s_.front() || s_query > s_.back()) {
+            throw std::runtime_error("Query s is out of track range!");
+        }
+        return s_query;
+    }
+
+    TrackPoint2<T> interpolate_segment(size_t i, T s_query) const {
+        const size_t j = (i + 1) % size_;
+        const auto& p1 = points_[i];
+        const auto& p2 = points_[j];
+        const T ds = s_[i + 1] - s_[i];
+        const T u = ds > T(0) ? (s_query - s_[i]) / ds : T(0);
+
+        TrackPoint2<T> interpolated;
+        interpolated.s = s_query;
+        interpolated.kappa = p1.kappa + u * (p2.kappa - p1.kappa);
+        interpolated.wl = p1.wl + u * (p2.wl - p1.wl);
+        interpolated.wr = p1.wr + u * (p2.wr - p1.wr);
+
+        if (mode_ == InterpolationMode::Linear) {
+            interpolated.x = p1.x + u * (p2.x - p1.x);
+            interpolated.y = p1.y + u * (p2.y - p1.y);
+            interpolated.psi = normalize_psi(p1.psi + u * dpsi_[i]);
+            return interpolated;
+        }
+
+        // Cubic Hermite basis
+        const T u2 = u * u;
+        const T u3 = u2 * u;
+        const T h00 = T(2) * u3 - T(3) * u2 + T(1);
+        const T h10 = u3 - T(2) * u2 + u;
+        const T h01 = T(-2) * u3 + T(3) * u2;
+        const T h11 = u3 - u2;
+
+        interpolated.x = h00 * p1.x + h10 * ds * cos_psi_[i] + h01 * p2.x + h11 * ds * cos_psi_[j];
+        interpolated.y = h00 * p1.y + h10 * ds * sin_psi_[i] + h01 * p2.y + h11 * ds * sin_psi_[j];
+
+        // psi relative to p1.psi, ending at p1.psi + dpsi
+        interpolated.psi = normalize_psi(p1.psi + h10 * ds * p1.kappa + h01 * dpsi_[i] + h11 * ds * p2.kappa);
+        return interpolated;
+    }
+
+    const TrackPoint2<T>* points_;
+    size_t size_;
+    bool is_closed_;
+    InterpolationMode mode_;
+
+    std::vector<T> s_;        // Station of every segment start and the end of the last segment
+    std::vector<T> dpsi_;     // Wrapped heading change of every segment
+    std::vector<T> cos_psi_;  // Heading directions of every point
+    std::vector<T> sin_psi_;
+};
+
+typedef TrackInterpolator2<float> TrackInterpolator2f;
+typedef TrackInterpolator2<double> TrackInterpolator2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_INTERPOLATOR_HPP
@@ -1,6 +1,10 @@
 #ifndef TRAJECTORY_HELPER__TRACK__TRACK_POINT_HPP
 #define TRAJECTORY_HELPER__TRACK__TRACK_POINT_HPP
 
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
 #include "trajectory_helper/point/point.hpp"
 
 namespace th {
@@ -8,18 +12,17 @@ template<typename T>
 struct TrackPoint2 {
     T s, x, y, psi, wl, wr, kappa;
 
-    TrackPoint2() : s(std::numeric_limits<T>::infinity()), x(std::numeric_limits<T>::infinity()), y(std::numeric_limits<T>::infinity()), psi(std::numeric_limits<T>::infinity()), wl(std::numeric_limits<T>::infinity()), wr(std::numeric_limits<T>::infinity()), kappa(std::numeric_limits<T>::infinity()) {}
-    TrackPoint2(T x, T y) : s(std::numeric_limits<T>::infinity()), x(x), y(y), psi(std::numeric_limits<T>::infinity()), wl(std::numeric_limits<T>::infinity()), wr(std::numeric_limits<T>::infinity()), kappa(std::numeric_limits<T>::infinity()) {}
-    TrackPoint2(T x, T y, T psi) : s(std::numeric_limits<T>::infinity()), x(x), y(y), psi(psi), wl(std::numeric_limits<T>::infinity()), wr(std::numeric_limits<T>::infinity()), kappa(std::numeric_limits<T>::infinity()) {}
-    TrackPoint2(T x, T y, T wl, T wr) : s(std::numeric_limits<T>::infinity()), x(x), y(y), psi(std::numeric_limits<T>::infinity()), wl(wl), wr(wr), kappa(std::numeric_limits<T>::infinity()) {}
-    TrackPoint2(T x, T y, T psi, T wl, T wr) : s(std::numeric_limits<T>::infinity()), x(x), y(y), psi(psi), wl(wl), wr(wr), kappa(std::numeric_limits<T>::infinity()) {}
-    TrackPoint2(T x, T y, T psi, T wl, T wr, T kappa) : s(std::numeric_limits<T>::infinity()), x(x), y(y), psi(psi), wl(wl), wr(wr), kappa(kappa) {}
-    TrackPoint2(T s, T x, T y, T psi, T wl, T wr, T kappa) : s(s), x(x), y(y), psi(psi), wl(wl), wr(wr), kappa(kappa) {}
+    constexpr TrackPoint2() : s(std::numeric_limits<T>::infinity()), x(std::numeric_limits<T>::infinity()), y(std::numeric_limits<T>::infinity()), psi(std::numeric_limits<T>::infinity()), wl(std::numeric_limits<T>::infinity()), wr(std::numeric_limits<T>::infinity()), kappa(std::numeric_limits<T>::infinity()) {}
+    constexpr TrackPoint2(T x, T y) : s(std::numeric_limits<T>::infinity()), x(x), y(y), psi(std::numeric_limits<T>::infinity()), wl(std::numeric_limits<T>::infinity()), wr(std::numeric_limits<T>::infinity()), kappa(std::numeric_limits<T>::infinity()) {}
+    constexpr TrackPoint2(T x, T y, T psi) : s(std::numeric_limits<T>::infinity()), x(x), y(y), psi(psi), wl(std::numeric_limits<T>::infinity()), wr(std::numeric_limits<T>::infinity()), kappa(std::numeric_limits<T>::infinity()) {}
+    constexpr TrackPoint2(T x, T y, T wl, T wr) : s(std::numeric_limits<T>::infinity()), x(x), y(y), psi(std::numeric_limits<T>::infinity()), wl(wl), wr(wr), kappa(std::numeric_limits<T>::infinity()) {}
+    constexpr TrackPoint2(T x, T y, T psi, T wl, T wr) : s(std::numeric_limits<T>::infinity()), x(x), y(y), psi(psi), wl(wl), wr(wr), kappa(std::numeric_limits<T>::infinity()) {}
+    constexpr TrackPoint2(T x, T y, T psi, T wl, T wr, T kappa) : s(std::numeric_limits<T>::infinity()), x(x), y(y), psi(psi), wl(wl), wr(wr), kappa(kappa) {}
+    constexpr TrackPoint2(T s, T x, T y, T psi, T wl, T wr, T kappa) : s(s), x(x), y(y), psi(psi), wl(wl), wr(wr), kappa(kappa) {}
 
-    TrackPoint2(const Point2<T>& point) : s(std::numeric_limits<T>::infinity()), x(point.x), y(point.y), psi(std::numeric_limits<T>::infinity()), wl(std::numeric_limits<T>::infinity()), wr(std::numeric_limits<T>::infinity()), kappa(std::numeric_limits<T>::infinity()) {}
+    constexpr TrackPoint2(const Point2<T>& point) : s(std::numeric_limits<T>::infinity()), x(point.x), y(point.y), psi(std::numeric_limits<T>::infinity()), wl(std::numeric_limits<T>::infinity()), wr(std::numeric_limits<T>::infinity()), kappa(std::numeric_limits<T>::infinity()) {}
 
-    Point2<T> to_point() const { return Point2<T>(x, y); }
-    Point2<T> to_point() { return Point2<T>(x, y); }
+    constexpr Point2<T> to_point() const { return Point2<T>(x, y); }
 
     bool has_s() const { return !std::isinf(s); }
     bool has_psi() const { return !std::isinf(psi); }
@@ -31,6 +34,53 @@ typedef TrackPoint2<int> TrackPoint2i;
 typedef TrackPoint2<float> TrackPoint2f;
 typedef TrackPoint2<double> TrackPoint2d;
 
+/**
+ * Track point with elevation: z, the slope along the track (pitch, positive uphill) and the
+ * bank angle across it (roll, positive when the left edge is higher), both in radians. s is
+ * the arc length in 3D, psi the heading in the xy plane and kappa the change of psi per unit of
+ * s, which on a grade is the curvature of the xy projection times cos(slope).
+ */
+template<typename T>
+struct TrackPoint3 {
+    T s, x, y, z, psi, wl, wr, kappa, slope, bank;
+
+    constexpr TrackPoint3() : s(inf()), x(inf()), y(inf()), z(inf()), psi(inf()), wl(inf()), wr(inf()), kappa(inf()), slope(inf()), bank(inf()) {}
+    constexpr TrackPoint3(T x, T y, T z) : s(inf()), x(x), y(y), z(z), psi(inf()), wl(inf()), wr(inf()), kappa(inf()), slope(inf()), bank(inf()) {}
+    constexpr TrackPoint3(T x, T y, T z, T wl, T wr) : s(inf()), x(x), y(y), z(z), psi(inf()), wl(wl), wr(wr), kappa(inf()), slope(inf()), bank(inf()) {}
+    constexpr TrackPoint3(T x, T y, T z, T wl, T wr, T bank) : s(inf()), x(x), y(y), z(z), psi(inf()), wl(wl), wr(wr), kappa(inf()), slope(inf()), bank(bank) {}
+    constexpr TrackPoint3(T s, T x, T y, T z, T psi, T wl, T wr, T kappa, T slope, T bank) : s(s), x(x), y(y), z(z), psi(psi), wl(wl), wr(wr), kappa(kappa), slope(slope), bank(bank) {}
+
+    constexpr TrackPoint3(const Point3<T>& point) : TrackPoint3(point.x, point.y, point.z) {}
+
+    constexpr Point3<T> to_point() const { return Point3<T>(x, y, z); }
+
+    bool has_s() const { return !std::isinf(s); }
+    bool has_psi() const { return !std::isinf(psi); }
+    bool has_kappa() const { return !std::isinf(kappa); }
+    bool has_widths() const { return !std::isinf(wr) && !std::isinf(wl); }
+    bool has_slope() const { return !std::isinf(slope); }
+    bool has_bank() const { return !std::isinf(bank); }
+
+private:
+    static constexpr T inf() { return std::numeric_limits<T>::infinity(); }
+};
+
+typedef TrackPoint3<float> TrackPoint3f;
+typedef TrackPoint3<double> TrackPoint3d;
+
+/**
+ * Whether P carries elevation. The track algorithms branch on it at compile time, so the 2D
+ * instantiations contain no elevation code at all.
+ */
+template<typename P>
+struct is_track_point3 : std::false_type {};
+
+template<typename T>
+struct is_track_point3<TrackPoint3<T>> : std::true_type {};
+
+template<typename P>
+inline constexpr bool is_track_point3_v = is_track_point3<P>::value;
+
 
 }  // namespace th
 
@@ -0,0 +1,156 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_POINT_INDEX_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_POINT_INDEX_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "trajectory_helper/point/point.hpp"
+#include "trajectory_helper/spatial/grid_index.hpp"
+#include "trajectory_helper/track/track.hpp"
+#include "trajectory_helper/track/track_algorithm.hpp"
+
+namespace th {
+
+/**
+ * Grid index over track points for k-nearest and radius queries.
+ *
+ * Results match the brute force find_k_nearest_idx / find_within_radius_idx: indices by
+ * increasing distance, ties by index. k-nearest queries visit rings of cells around the
+ * query with a bounded heap and stop once no unvisited point can enter the heap; a query so far
+ * from the track that the rings would cover more cells than are occupied scans all points.
+ *
+ * The index keeps a pointer to the track points, so the track must outlive it and must not be
+ * modified or reallocated.
+ */
+template<typename T>
+class TrackPointIndex2 {
+    static_assert(std::is_floating_point<T>::value, "TrackPointIndex2 requires floating point coordinates.");
+
+public:
+    /**
+     * cell_size <= 0 selects twice the average point spacing
+     */
+    template<typename Allocator>
+    explicit TrackPointIndex2(const Track2<T, Allocator>& track, T cell_size = T(0))
+    : points_(track.data()), size_(track.size()), grid_(select_cell_size(track, cell_size))
+    {
+        for (size_t i = 0; i < size_; ++i) {
+            grid_.insert(i, track[i].to_point());
+        }
+    }
+
+    size_t size() const { return size_; }
+    const GridIndex2<T>& grid() const { return grid_; }
+
+    // Indices of the k closest points, written to out; allocates a heap of min(k, size()) pairs
+    template<typename OutputIt>
+    OutputIt k_nearest(const Point2<T>& point, size_t k, OutputIt out) const {
+        detail::NearestHeap<T> heap(std::min(k, size_));
+        if (k == 0) {
+            return out;
+        }
+        const std::int64_t cx = grid_.cell_coord(point.x);
+        const std::int64_t cy = grid_.cell_coord(point.y);
+        auto push = [&](size_t i) { heap.push(distance(points_[i], point), i); };
+        // Unvisited points are at least ring * cell_size away
+        const bool searched = grid_.for_each_ring(cx, cy, push, [&](std::int64_t ring) {
+            return heap.full() && heap.worst() < static_cast<T>(ring) * grid_.cell_size();
+        });
+        if (!searched) {
+            heap.clear();
+            for (size_t i = 0; i < size_; ++i) push(i);
+        }
+        return heap.pop_sorted(out);
+    }
+
+    std::vector<size_t> k_nearest(const Point2<T>& point, size_t k) const {
+        std::vector<size_t> nearest;
+        nearest.reserve(std::min(k, size_));
+        k_nearest(point, k, std::back_inserter(nearest));
+        return nearest;
+    }
+
+    // Indices of all points within radius, written to out; the results are sorted in a vector
+    // allocated per call
+    template<typename OutputIt>
+    OutputIt within_radius(const Point2<T>& point, T radius, OutputIt out) const {
+        std::vector<std::pair<T, size_t>> found;
+        grid_.for_each_in_box(Point2<T>(point.x - radius, point.y - radius), Point2<T>(point.x + radius, point.y + radius),
+            [&](size_t i) {
+                T dist = distance(points_[i], point);
+                if (dist <= radius) {
+                    found.emplace_back(dist, i);
+                }
+            });
+        std::sort(found.begin(), found.end());
+        for (const auto& item : found) {
+            *out++ = item.second;
+        }
+        return out;
+    }
+
+    std::vector<size_t> within_radius(const Point2<T>& point, T radius) const {
+        std::vector<size_t> found;
+        within_radius(point, radius, std::back_inserter(found));
+        return found;
+    }
+
+    /**
+     * k-nearest for every query point of [first, last). Query q writes its min(k, size())
+     * indices to out[q * min(k, size()), ...).
+     */
+    template<typename InputIt, typename OutputIt>
+    OutputIt k_nearest(InputIt first, InputIt last, size_t k, OutputIt out) const {
+        for (; first != last; ++first) {
+            out = k_nearest(Point2<T>(*first), k, out);
+        }
+        return out;
+    }
+
+    /**
+     * Radius query for every point of [first, last) in compressed rows: the indices of query q
+     * are indices[offsets[q], offsets[q + 1]). Both vectors are cleared first.
+     */
+    template<typename InputIt>
+    void within_radius(InputIt first, InputIt last, T radius, std::vector<size_t>& indices, std::vector<size_t>& offsets) const {
+        indices.clear();
+        offsets.assign(1, 0);
+        for (; first != last; ++first) {
+            within_radius(Point2<T>(*first), radius, std::back_inserter(indices));
+            offsets.push_back(indices.size());
+        }
+    }
+
+private:
+    template<typename Allocator>
+    static T select_cell_size(const Track2<T, Allocator>& track, T cell_size) {
+        if (track.empty()) {
+            throw std::runtime_error("Track is empty!");
+        }
+        if (cell_size > T(0)) {
+            return cell_size;
+        }
+        T length = T();
+        for (size_t i = 1; i < track.size(); ++i) {
+            length += distance(track[i - 1], track[i]);
+        }
+        const T avg = track.size() > 1 ? length / static_cast<T>(track.size() - 1) : T();
+        return avg > T(0) ? T(2) * avg : T(1);
+    }
+
+    const TrackPoint2<T>* points_;
+    size_t size_;
+    GridIndex2<T> grid_;
+};
+
+typedef TrackPointIndex2<float> TrackPointIndex2f;
+typedef TrackPointIndex2<double> TrackPointIndex2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_POINT_INDEX_HPP
@@ -0,0 +1,95 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_PROGRESS_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_PROGRESS_HPP
+
+#include <cmath>
+#include <stdexcept>
+
+#include "trajectory_helper/utils.hpp"
+#include "trajectory_helper/point/point.hpp"
+#include "trajectory_helper/track/track.hpp"
+#include "trajectory_helper/track/track_algorithm.hpp"
+
+namespace th {
+
+/**
+ * Lap-aware progress along a closed track.
+ *
+ * Every update projects the position with sweep_segment_projection from the previous segment
+ * and unwraps the station across the seam, so s() increases continuously over multiple laps
+ * (and decreases when driving backwards). A match at the edge of the search window keeps
+ * following the track while it gets closer, e.g. after a jump of the position.
+ *
+ * The tracker keeps a pointer to the track points, so the track must outlive it and must not
+ * be modified or reallocated.
+ */
+template<typename T>
+class ProgressTracker2 {
+public:
+    template<typename Allocator>
+    explicit ProgressTracker2(const Track2<T, Allocator>& track, size_t window = 8)
+    : points_(track.data()), size_(track.size()), window_(window)
+    {
+        if (track.size() < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+        if (!track.has_s()) {
+            throw std::runtime_error("Track must have s values! Call calculate() first.");
+        }
+        s_min_ = track.front().s;
+        length_ = track_length(track.begin(), track.end(), true);
+    }
+
+    /**
+     * Projects point onto the track and returns the continuous s
+     */
+    T update(const Point2<T>& point) {
+        const bool initialized = sweep_.valid;
+        auto projection = sweep_segment_projection(points_, points_ + size_, point, sweep_, window_, true);
+
+        const T lap_s = wrap_s(segment_projection_point(points_, points_ + size_, projection).s, s_min_, length_);
+        s_ = initialized ? s_ + s_diff(lap_s, lap_s_, length_) : lap_s;
+        lap_s_ = lap_s;
+        return s_;
+    }
+
+    // Continuous s since the start of lap 0
+    T s() const { return s_; }
+
+    // s within the current lap, in [s_min, s_min + length)
+    T lap_s() const { return lap_s_; }
+
+    // Number of completed laps, negative when driving backwards across the start
+    long lap() const { return static_cast<long>(std::floor((s_ - s_min_) / length_)); }
+
+    // Wrap-safe signed difference between the current position and lap station s
+    T s_diff_to(T s) const { return th::s_diff(lap_s_, s, length_); }
+
+    T length() const { return length_; }
+    size_t segment() const { return sweep_.segment; }
+    bool initialized() const { return sweep_.valid; }
+
+    // Forgets the position; the next update searches the whole track and starts at lap 0
+    void reset() {
+        sweep_ = SegmentSweep();
+        s_ = T();
+        lap_s_ = T();
+    }
+
+private:
+    const TrackPoint2<T>* points_;
+    size_t size_;
+    size_t window_;
+    T s_min_ = T();
+    T length_ = T();
+
+    SegmentSweep sweep_;
+    T s_ = T();
+    T lap_s_ = T();
+};
+
+typedef ProgressTracker2<float> ProgressTracker2f;
+typedef ProgressTracker2<double> ProgressTracker2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_PROGRESS_HPP
@@ -0,0 +1,157 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_PROJECTOR_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_PROJECTOR_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#include "trajectory_helper/instrumentation.hpp"
+#include "trajectory_helper/point/point.hpp"
+#include "trajectory_helper/spatial/grid_index.hpp"
+#include "trajectory_helper/track/track.hpp"
+#include "trajectory_helper/track/track_algorithm.hpp"
+
+namespace th {
+
+/**
+ * Reusable projection engine over a const track.
+ *
+ * Owns a grid index over the track segments and answers the same query as Track2::project
+ * (closest segment, ties going to the lower segment index) by visiting rings of grid cells
+ * around the query until no unvisited segment can be closer. The projector itself is
+ * immutable after construction, so one instance can be shared across threads; streaming
+ * state lives in a Context per thread (or per stream).
+ *
+ * The projector keeps a pointer to the track points, so the track must outlive it and must not
+ * be modified or reallocated.
+ */
+template<typename T>
+class TrackProjector2 {
+public:
+    /**
+     * Per-stream query state: the segment of the last result seeds the next search
+     */
+    using Context = SegmentSweep;
+
+    /**
+     * cell_size <= 0 selects four times the average segment length
+     */
+    template<typename Allocator>
+    explicit TrackProjector2(const Track2<T, Allocator>& track, bool is_closed = true, T cell_size = T(0), size_t window = 4)
+    : points_(track.data()), size_(track.size()), is_closed_(is_closed), window_(window),
+      grid_(select_cell_size(track, is_closed, cell_size))
+    {
+        for (size_t i = 0; i < n_segments(); ++i) {
+            const auto& p1 = points_[i];
+            const auto& p2 = points_[(i + 1) % size_];
+            grid_.insert(i,
+                Point2<T>(std::min(p1.x, p2.x), std::min(p1.y, p2.y)),
+                Point2<T>(std::max(p1.x, p2.x), std::max(p1.y, p2.y)));
+        }
+    }
+
+    size_t n_segments() const { return is_closed_ ? size_ : size_ - 1; }
+    bool is_closed() const { return is_closed_; }
+    const GridIndex2<T>& grid() const { return grid_; }
+
+    /**
+     * Closest projection onto the track segments, identical to find_segment_projection over
+     * the whole track
+     */
+    SegmentProjection<T> project_segment(const Point2<T>& point) const {
+        return search(point, SegmentProjection<T>());
+    }
+
+    /**
+     * Streaming variant: a sweep from the previous result of ctx (sweep_segment_projection)
+     * bounds the search, then ctx is updated
+     */
+    SegmentProjection<T> project_segment(const Point2<T>& point, Context& ctx) const {
+        SegmentProjection<T> seed;
+        if (ctx.valid) {
+            seed = sweep_segment_projection(points_, points_ + size_, point, ctx, window_, is_closed_);
+        }
+        SegmentProjection<T> best = search(point, seed);
+        ctx.segment = best.segment;
+        ctx.valid = true;
+        return best;
+    }
+
+    // Same result as Track2::project(point, is_closed)
+    TrackPoint2<T> project(const Point2<T>& point) const {
+        TH_INSTRUMENT(Project, 1);
+        return segment_projection_point(points_, points_ + size_, project_segment(point));
+    }
+
+    TrackPoint2<T> project(const Point2<T>& point, Context& ctx) const {
+        TH_INSTRUMENT(Project, 1);
+        return segment_projection_point(points_, points_ + size_, project_segment(point, ctx));
+    }
+
+    /**
+     * Projects every point of [first, last), seeding each search with the previous result
+     */
+    template<typename InputIt, typename OutputIt>
+    OutputIt project(InputIt first, InputIt last, OutputIt out) const {
+        Context ctx;
+        for (; first != last; ++first) {
+            *out++ = segment_projection_point(points_, points_ + size_, project_segment(Point2<T>(*first), ctx));
+        }
+        return out;
+    }
+
+private:
+    template<typename Allocator>
+    static T select_cell_size(const Track2<T, Allocator>& track, bool is_closed, T cell_size) {
+        if (track.size() < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+        if (cell_size > T(0)) {
+            return cell_size;
+        }
+        T length = T();
+        const size_t n = track.size();
+        const size_t n_segments = is_closed ? n : n - 1;
+        for (size_t i = 0; i < n_segments; ++i) {
+            length += distance(track[i], track[(i + 1) % n]);
+        }
+        const T avg = length / static_cast<T>(n_segments);
+        return avg > T(0) ? T(4) * avg : T(1);
+    }
+
+    // Ring search keeping the closest projection, ties going to the lower segment index; a
+    // query the rings cannot reach cheaply scans all segments
+    SegmentProjection<T> search(const Point2<T>& point, SegmentProjection<T> best) const {
+        auto consider = [&](size_t i) {
+            SegmentProjection<T> candidate = find_segment_projection(points_, points_ + size_, point, i, 1, is_closed_);
+            if (candidate.distance < best.distance || (candidate.distance == best.distance && candidate.segment < best.segment)) {
+                best = candidate;
+            }
+        };
+
+        const std::int64_t cx = grid_.cell_coord(point.x);
+        const std::int64_t cy = grid_.cell_coord(point.y);
+        // Unvisited segments are at least ring * cell_size away
+        const bool searched = grid_.for_each_ring(cx, cy, consider, [&](std::int64_t ring) {
+            return best.distance < static_cast<T>(ring) * grid_.cell_size();
+        });
+        if (!searched) {
+            for (size_t i = 0; i < n_segments(); ++i) consider(i);
+        }
+        return best;
+    }
+
+    const TrackPoint2<T>* points_;
+    size_t size_;
+    bool is_closed_;
+    size_t window_;
+    GridIndex2<T> grid_;
+};
+
+typedef TrackProjector2<float> TrackProjector2f;
+typedef TrackProjector2<double> TrackProjector2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_PROJECTOR_HPP
@@ -0,0 +1,155 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_PYRAMID_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_PYRAMID_HPP
+
+#include <vector>
+#include <stdexcept>
+#include <limits>
+#include <utility>
+
+#include "trajectory_helper/point/point.hpp"
+#include "trajectory_helper/track/track.hpp"
+
+namespace th {
+
+/**
+ * Multi-resolution (level-of-detail) pyramid over a Track2.
+ *
+ * Level 0 is the full track. Level l keeps every factor^l-th point, so coarse point j of level l
+ * maps back to the full track index range [j * stride(l), (j + 1) * stride(l)).
+ * Queries search the coarsest level exhaustively and then refine within +-search_radius
+ * neighbours on every finer level. This is a heuristic: a track that folds back onto itself
+ * closer than the coarse spacing can lead the search into the wrong branch.
+ *
+ * The pyramid keeps a pointer to the track points, so the track must outlive it and must not
+ * be modified or reallocated.
+ */
+template<typename T>
+class TrackPyramid2 {
+public:
+    template<typename Allocator>
+    explicit TrackPyramid2(const Track2<T, Allocator>& track, size_t factor = 4, size_t min_level_size = 64, size_t search_radius = 1)
+    : points_(track.data()), size_(track.size()), factor_(factor), search_radius_(search_radius)
+    {
+        if (track.size() < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+        if (factor < 2) {
+            throw std::runtime_error("Pyramid decimation factor must be at least 2.");
+        }
+
+        size_t stride = factor_;
+        while ((track.size() + stride - 1) / stride >= std::max<size_t>(min_level_size, 2)) {
+            std::vector<Point2<T>> level;
+            level.reserve((track.size() + stride - 1) / stride);
+            for (size_t i = 0; i < track.size(); i += stride) {
+                level.push_back(track[i].to_point());
+            }
+            levels_.push_back(std::move(level));
+            strides_.push_back(stride);
+            stride *= factor_;
+        }
+    }
+
+    // Number of levels including the full resolution track
+    size_t num_levels() const { return levels_.size() + 1; }
+
+    size_t level_size(size_t level) const {
+        return level == 0 ? size_ : levels_.at(level - 1).size();
+    }
+
+    size_t stride(size_t level) const {
+        return level == 0 ? 1 : strides_.at(level - 1);
+    }
+
+    // Range of full track indices [first, second) covered by point idx of the given level
+    std::pair<size_t, size_t> index_range(size_t level, size_t idx) const {
+        size_t first = idx * stride(level);
+        return {first, std::min(first + stride(level), size_)};
+    }
+
+    size_t find_nearest_idx(const Point2<T>& point, bool is_closed = true) const {
+        if (levels_.empty()) {
+            return th::find_nearest_idx(points_, points_ + size_, point);
+        }
+
+        // Exhaustive search on the coarsest level
+        const auto& coarsest = levels_.back();
+        size_t nearest = nearest_in_range(coarsest, point, 0, coarsest.size(), false);
+
+        // Refine level by level
+        for (size_t level = levels_.size(); level-- > 0;) {
+            size_t n_fine = level == 0 ? size_ : levels_[level - 1].size();
+            size_t n_coarse = level_size(level + 1);
+
+            // Children of the coarse neighbourhood [nearest - r, nearest + r]
+            size_t r = search_radius_;
+            size_t first, count;
+            if (is_closed && 2 * r + 1 < n_coarse) {
+                first = ((nearest + n_coarse - r) % n_coarse) * factor_;
+                count = (2 * r + 1) * factor_;
+            } else {
+                size_t lo = nearest > r ? nearest - r : 0;
+                size_t hi = std::min(nearest + r + 1, n_coarse);
+                first = lo * factor_;
+                count = std::min(hi * factor_, n_fine) - first;
+            }
+
+            if (level == 0) {
+                nearest = nearest_in_track(point, first, count);
+            } else {
+                nearest = nearest_in_range(levels_[level - 1], point, first, count, true);
+            }
+        }
+        return nearest;
+    }
+
+    TrackPoint2<T> project(const Point2<T>& point, bool is_closed = true) const {
+        size_t nearest = find_nearest_idx(point, is_closed);
+        // The nearest point is shared by the segments nearest - 1 and nearest
+        return project_on_track(points_, points_ + size_, point, nearest, search_radius_ + 1, is_closed);
+    }
+
+private:
+    static size_t nearest_in_range(const std::vector<Point2<T>>& points, const Point2<T>& point, size_t first, size_t count, bool wrap) {
+        T min_dist = std::numeric_limits<T>::max();
+        size_t nearest_idx = first;
+        for (size_t k = 0; k < count; ++k) {
+            size_t i = wrap ? (first + k) % points.size() : first + k;
+            if (!wrap && i >= points.size()) break;
+            T dist = distance(points[i], point);
+            if (dist < min_dist) {
+                min_dist = dist;
+                nearest_idx = i;
+            }
+        }
+        return nearest_idx;
+    }
+
+    size_t nearest_in_track(const Point2<T>& point, size_t first, size_t count) const {
+        T min_dist = std::numeric_limits<T>::max();
+        size_t nearest_idx = first % size_;
+        for (size_t k = 0; k < count; ++k) {
+            size_t i = (first + k) % size_;
+            T dist = distance(points_[i], point);
+            if (dist < min_dist) {
+                min_dist = dist;
+                nearest_idx = i;
+            }
+        }
+        return nearest_idx;
+    }
+
+    const TrackPoint2<T>* points_;
+    size_t size_;
+    size_t factor_;
+    size_t search_radius_;
+    std::vector<std::vector<Point2<T>>> levels_;  // levels 1..L
+    std::vector<size_t> strides_;
+};
+
+typedef TrackPyramid2<float> TrackPyramid2f;
+typedef TrackPyramid2<double> TrackPyramid2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_PYRAMID_HPP
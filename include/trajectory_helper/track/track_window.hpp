@@ -0,0 +1,180 @@
+#ifndef TRAJECTORY_HELPER__TRACK__TRACK_WINDOW_HPP
+#define TRAJECTORY_HELPER__TRACK__TRACK_WINDOW_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "trajectory_helper/utils.hpp"
+#include "trajectory_helper/track/track.hpp"
+#include "trajectory_helper/track/track_algorithm.hpp"
+
+namespace th {
+
+/**
+ * Non-owning view of the track points covering a horizon [s_start, s_start + length].
+ *
+ * On closed tracks the horizon can cross the seam. The view then has two pieces: the points
+ * up to the end of the track and the points from the front of the track onwards. Indexing
+ * the view returns copies whose s continues past the lap length, so s always increases.
+ * The view is invalidated by any modification of the track.
+ */
+template<typename T>
+struct TrackWindow2 {
+    const TrackPoint2<T>* first = nullptr;
+    size_t first_size = 0;
+    const TrackPoint2<T>* second = nullptr;
+    size_t second_size = 0;
+    T lap_length = T();
+
+    size_t size() const { return first_size + second_size; }
+    bool empty() const { return size() == 0; }
+    bool wraps() const { return second_size > 0; }
+
+    TrackPoint2<T> operator[](size_t i) const {
+        if (i < first_size) {
+            return first[i];
+        }
+        TrackPoint2<T> point = second[i - first_size];
+        point.s += lap_length;
+        return point;
+    }
+};
+
+namespace detail {
+
+// Wraps s into [s_min, s_min + length) for closed tracks or checks the range of open tracks
+template<typename T>
+T window_start(T s_start, T s_min, T s_max, bool is_closed) {
+    if (is_closed) {
+        if (s_start < s_min || s_start >= s_max) {
+            s_start = wrap_s(s_start, s_min, s_max - s_min);
+        }
+        return s_start;
+    }
+    if (s_start < s_min || s_start > s_max) {
+        throw std::runtime_error("Query s is out of track range!");
+    }
+    return s_start;
+}
+
+}  // namespace detail
+
+/**
+ * Returns the points covering [s_start, s_start + length], starting with the point at or
+ * before s_start and ending with the point at or after the horizon end. The horizon is
+ * clamped to one lap on closed tracks and to the track end on open tracks.
+ * Costs O(log N); no points are copied.
+ */
+template<typename T, typename Allocator>
+TrackWindow2<T> horizon_window(const Track2<T, Allocator>& track, T s_start, T length, bool is_closed = true) {
+    if (track.size() < 2) {
+        throw std::runtime_error("Track must have at least 2 points!");
+    }
+    if (!track.has_s()) {
+        throw std::runtime_error("Track must have s values to interpolate! Call calculate() first.");
+    }
+
+    const size_t n = track.size();
+    const T s_min = track.front().s;
+    const T s_max = is_closed ? track_length(track.begin(), track.end(), true) : track.back().s;
+    s_start = detail::window_start(s_start, s_min, s_max, is_closed);
+    length = std::min(std::max(length, T()), s_max - s_min);
+    const T s_end = s_start + length;
+
+    auto by_s = [](const TrackPoint2<T>& p, T s) { return p.s < s; };
+
+    // Last point at or before s_start
+    size_t idx0 = static_cast<size_t>(std::distance(track.begin(),
+        std::upper_bound(track.begin(), track.end(), s_start, [](T s, const TrackPoint2<T>& p) { return s < p.s; })));
+    idx0 = idx0 > 0 ? idx0 - 1 : 0;
+
+    TrackWindow2<T> window;
+    window.lap_length = s_max - s_min;
+    window.first = track.data() + idx0;
+
+    if (!is_closed || s_end <= track.back().s) {
+        // First point at or after the horizon end
+        size_t idx1 = static_cast<size_t>(std::distance(track.begin(),
+            std::lower_bound(track.begin() + idx0, track.end(), s_end, by_s)));
+        window.first_size = std::min(idx1, n - 1) - idx0 + 1;
+        return window;
+    }
+
+    // The horizon crosses the seam: the second piece starts at the front of the track
+    window.first_size = n - idx0;
+    size_t idx1 = static_cast<size_t>(std::distance(track.begin(),
+        std::lower_bound(track.begin(), track.begin() + idx0, s_end - window.lap_length, by_s)));
+    window.second = track.data();
+    window.second_size = std::min(idx1 + 1, idx0 + 1);
+    return window;
+}
+
+/**
+ * Resamples the horizon at s_start + k * stepsize for k = 0..floor(length / stepsize) and
+ * writes the points to out, e.g. a reusable buffer of fixed size. s continues past the lap
+ * length on closed tracks; on open tracks samples past the end repeat the last point.
+ * Costs O(log N + horizon points).
+ */
+template<typename T, typename Allocator, typename OutputIt>
+OutputIt resample_window(const Track2<T, Allocator>& track, T s_start, T length, T stepsize, OutputIt out, bool is_closed = true) {
+    if (!(stepsize > T(0))) {
+        throw std::runtime_error("Stepsize must be positive.");
+    }
+    if (track.size() < 2) {
+        throw std::runtime_error("Track must have at least 2 points!");
+    }
+    if (!track.has_s()) {
+        throw std::runtime_error("Track must have s values to interpolate! Call calculate() first.");
+    }
+
+    const size_t n = track.size();
+    const T s_min = track.front().s;
+    const T s_max = is_closed ? track_length(track.begin(), track.end(), true) : track.back().s;
+    const T lap_length = s_max - s_min;
+    s_start = detail::window_start(s_start, s_min, s_max, is_closed);
+
+    // Last point at or before s_start
+    size_t idx = static_cast<size_t>(std::distance(track.begin(),
+        std::upper_bound(track.begin(), track.end(), s_start, [](T s, const TrackPoint2<T>& p) { return s < p.s; })));
+    idx = idx > 0 ? idx - 1 : 0;
+
+    // Samples beyond one lap keep walking around the track
+    const size_t n_samples = static_cast<size_t>(std::floor(std::max(length, T()) / stepsize)) + 1;
+    size_t lap = 0;
+    auto point_at = [&](size_t i, size_t lap_offset) {
+        TrackPoint2<T> p = track[i % n];
+        p.s += static_cast<T>(lap_offset + i / n) * lap_length;
+        return p;
+    };
+
+    for (size_t k = 0; k < n_samples; ++k) {
+        T s = s_start + static_cast<T>(k) * stepsize;
+        if (!is_closed) {
+            if (s >= track.back().s) {
+                *out++ = track.back();
+                continue;
+            }
+            while (idx + 1 < n && track[idx + 1].s <= s) ++idx;
+            *out++ = interpolate_segment(track[idx], track[idx + 1], track[idx + 1].s, s);
+            continue;
+        }
+
+        // Closed: virtual point sequence ..., n - 1, n (= front + lap), n + 1, ...
+        TrackPoint2<T> p2 = point_at(idx + 1, lap);
+        while (p2.s <= s) {
+            ++idx;
+            if (idx == n) {
+                idx = 0;
+                ++lap;
+            }
+            p2 = point_at(idx + 1, lap);
+        }
+        *out++ = interpolate_segment(point_at(idx, lap), p2, p2.s, s);
+    }
+    return out;
+}
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRACK__TRACK_WINDOW_HPP
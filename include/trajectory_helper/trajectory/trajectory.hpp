@@ -0,0 +1,168 @@
+#ifndef TRAJECTORY_HELPER__TRAJECTORY__TRAJECTORY_HPP
+#define TRAJECTORY_HELPER__TRAJECTORY__TRAJECTORY_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "trajectory_helper/utils.hpp"
+#include "trajectory_helper/track/track.hpp"
+#include "trajectory_helper/trajectory/trajectory_point.hpp"
+
+namespace th {
+
+/**
+ * Time-parameterized trajectory: a track with t/v/a columns.
+ *
+ * Between two points the acceleration is constant, so sampling by time reproduces the
+ * velocity profile exactly and places the point at the matching station s.
+ */
+template<typename T>
+class Trajectory2 : public std::vector<TrajectoryPoint2<T>> {
+public:
+    // Inherit vector constructors
+    using std::vector<TrajectoryPoint2<T>>::vector;
+
+    /**
+     * Builds a trajectory from a calculated track and a velocity per track point.
+     * Closed tracks get the first point appended at s = track length to cover one full lap.
+     */
+    template<typename Allocator>
+    Trajectory2(const Track2<T, Allocator>& track, const std::vector<T>& v, bool is_closed = true) {
+        if (track.size() < 2) {
+            throw std::runtime_error("Track must have at least 2 points!");
+        }
+        if (!track.has_s()) {
+            throw std::runtime_error("Track must have s values! Call calculate() first.");
+        }
+        if (v.size() != track.size()) {
+            throw std::runtime_error("Velocity profile must have the same size as the track.");
+        }
+
+        this->reserve(track.size() + (is_closed ? 1 : 0));
+        for (size_t i = 0; i < track.size(); ++i) {
+            this->push_back(TrajectoryPoint2<T>(track[i], T(), v[i], T()));
+        }
+        if (is_closed) {
+            this->push_back(TrajectoryPoint2<T>(track.front(), T(), v.front(), T()));
+            this->back().s = track_length(track.begin(), track.end(), true);
+        }
+
+        // Constant acceleration per segment: dt = 2 ds / (v1 + v2), a = (v2² - v1²) / (2 ds)
+        (*this)[0].t = T();
+        for (size_t i = 0; i + 1 < this->size(); ++i) {
+            auto& p1 = (*this)[i];
+            auto& p2 = (*this)[i + 1];
+            T ds = p2.s - p1.s;
+            T v_sum = p1.v + p2.v;
+            if (!(v_sum > T(0))) {
+                throw std::runtime_error("Velocity profile must not stop between two points.");
+            }
+            p2.t = p1.t + T(2) * ds / v_sum;
+            p1.a = ds > T(0) ? (p2.v * p2.v - p1.v * p1.v) / (T(2) * ds) : T();
+        }
+        this->back().a = (*this)[this->size() - 2].a;
+    }
+
+    T duration() const {
+        if (this->empty()) return T();
+        return this->back().t - this->front().t;
+    }
+
+    /**
+     * Samples the trajectory at time t (O(log N), see TrajectorySampler2 for O(1) streams)
+     */
+    TrajectoryPoint2<T> sample(T t) const {
+        return sample_segment(find_segment(t), t);
+    }
+
+    // Index of the segment [idx, idx + 1] containing t
+    size_t find_segment(T t) const {
+        check_time(t);
+        auto it = std::upper_bound(this->begin(), this->end(), t,
+            [](T t, const TrajectoryPoint2<T>& p) { return t < p.t; });
+        size_t idx = static_cast<size_t>(std::distance(this->begin(), it));
+        return std::min(idx > 0 ? idx - 1 : 0, this->size() - 2);
+    }
+
+    // Samples time t on segment [idx, idx + 1]
+    TrajectoryPoint2<T> sample_segment(size_t idx, T t) const {
+        const auto& p1 = (*this)[idx];
+        const auto& p2 = (*this)[idx + 1];
+
+        T tau = t - p1.t;
+        T ds = p2.s - p1.s;
+        T ds_tau = p1.v * tau + T(0.5) * p1.a * tau * tau;
+        T alpha = ds > T(0) ? std::clamp(ds_tau / ds, T(0), T(1)) : T(0);
+
+        TrajectoryPoint2<T> sampled;
+        sampled.t = t;
+        sampled.v = p1.v + p1.a * tau;
+        sampled.a = p1.a;
+        sampled.s = p1.s + alpha * ds;
+        sampled.x = p1.x + alpha * (p2.x - p1.x);
+        sampled.y = p1.y + alpha * (p2.y - p1.y);
+        sampled.psi = normalize_psi(p1.psi + alpha * angle_diff(p2.psi, p1.psi));
+        sampled.kappa = p1.kappa + alpha * (p2.kappa - p1.kappa);
+        sampled.wl = p1.wl + alpha * (p2.wl - p1.wl);
+        sampled.wr = p1.wr + alpha * (p2.wr - p1.wr);
+        return sampled;
+    }
+
+private:
+    void check_time(T t) const {
+        if (this->size() < 2) {
+            throw std::runtime_error("Trajectory must have at least 2 points!");
+        }
+        if (t < this->front().t || t > this->back().t) {
+            throw std::runtime_error("Query t is out of trajectory range!");
+        }
+    }
+}; // class Trajectory2
+
+typedef Trajectory2<float> Trajectory2f;
+typedef Trajectory2<double> Trajectory2d;
+
+/**
+ * Streaming sampler keeping a cursor on the current segment.
+ *
+ * Monotonically increasing query times cost O(1) amortized; a query earlier than the cursor
+ * falls back to a binary search. The trajectory must outlive the sampler.
+ */
+template<typename T>
+class TrajectorySampler2 {
+public:
+    explicit TrajectorySampler2(const Trajectory2<T>& trajectory) : trajectory_(&trajectory), idx_(0) {
+        if (trajectory.size() < 2) {
+            throw std::runtime_error("Trajectory must have at least 2 points!");
+        }
+    }
+
+    TrajectoryPoint2<T> sample(T t) {
+        const auto& trajectory = *trajectory_;
+        if (t < trajectory[idx_].t || t > trajectory.back().t) {
+            idx_ = trajectory.find_segment(t);
+        } else {
+            while (idx_ + 2 < trajectory.size() && t > trajectory[idx_ + 1].t) {
+                ++idx_;
+            }
+        }
+        return trajectory.sample_segment(idx_, t);
+    }
+
+    size_t segment() const { return idx_; }
+
+    void reset() { idx_ = 0; }
+
+private:
+    const Trajectory2<T>* trajectory_;
+    size_t idx_;
+};
+
+typedef TrajectorySampler2<float> TrajectorySampler2f;
+typedef TrajectorySampler2<double> TrajectorySampler2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRAJECTORY__TRAJECTORY_HPP
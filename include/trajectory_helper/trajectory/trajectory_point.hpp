@@ -0,0 +1,32 @@
+#ifndef TRAJECTORY_HELPER__TRAJECTORY__TRAJECTORY_POINT_HPP
+#define TRAJECTORY_HELPER__TRAJECTORY__TRAJECTORY_POINT_HPP
+
+#include <cmath>
+#include <limits>
+
+#include "trajectory_helper/track/track_point.hpp"
+
+namespace th {
+
+/**
+ * Track point extended with time t, velocity v and acceleration a
+ */
+template<typename T>
+struct TrajectoryPoint2 : public TrackPoint2<T> {
+    T t, v, a;
+
+    constexpr TrajectoryPoint2() : TrackPoint2<T>(), t(std::numeric_limits<T>::infinity()), v(std::numeric_limits<T>::infinity()), a(std::numeric_limits<T>::infinity()) {}
+    constexpr TrajectoryPoint2(const TrackPoint2<T>& point) : TrackPoint2<T>(point), t(std::numeric_limits<T>::infinity()), v(std::numeric_limits<T>::infinity()), a(std::numeric_limits<T>::infinity()) {}
+    constexpr TrajectoryPoint2(const TrackPoint2<T>& point, T t, T v, T a) : TrackPoint2<T>(point), t(t), v(v), a(a) {}
+
+    bool has_t() const { return !std::isinf(t); }
+    bool has_v() const { return !std::isinf(v); }
+    bool has_a() const { return !std::isinf(a); }
+};
+
+typedef TrajectoryPoint2<float> TrajectoryPoint2f;
+typedef TrajectoryPoint2<double> TrajectoryPoint2d;
+
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TRAJECTORY__TRAJECTORY_POINT_HPP
@@ -4,6 +4,8 @@
 #include <cmath>
 #include <vector>
 #include <algorithm>
+#include <type_traits>
+#include <utility>
 
 namespace th {
 
@@ -14,9 +16,14 @@ namespace th {
 //     return std::fabs(a - b) < tol;
 // }
 
+/**
+ * Euclidean distance between two 2D points (x,y) in the precision of their coordinates
+ * (float for integer coordinates)
+ */
 template<typename T1, typename T2>
-float distance(const T1& p1, const T2& p2) {
-    return std::hypot(p1.x - p2.x, p1.y - p2.y);
+std::common_type_t<decltype(std::declval<T1>().x - std::declval<T2>().x), float> distance(const T1& p1, const T2& p2) {
+    using R = std::common_type_t<decltype(p1.x - p2.x), float>;
+    return std::hypot(static_cast<R>(p1.x - p2.x), static_cast<R>(p1.y - p2.y));
 }
 
 /**
@@ -27,14 +34,116 @@ float distance(const T1& p1, const T2& p2) {
 //     return (isClose(p1.x, p2.x, tol) && isClose(p1.y, p2.y, tol));
 // }
 
+namespace detail {
+
+/**
+ * Comparisons as T(0) / T(1) factors for branch-free kernels
+ *
+ * The quiet comparison builtins raise no FE_INVALID on NaN. GCC therefore vectorizes them under
+ * its default -ftrapping-math, while a plain `a > b ? x : y` on floating point stays a branch.
+ */
+template<typename T>
+T greater(T a, T b) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<T>(__builtin_isgreater(a, b));
+#else
+    return static_cast<T>(std::isgreater(a, b));
+#endif
+}
+
+template<typename T>
+T less(T a, T b) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<T>(__builtin_isless(a, b));
+#else
+    return static_cast<T>(std::isless(a, b));
+#endif
+}
+
+template<typename T>
+T less_equal(T a, T b) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<T>(__builtin_islessequal(a, b));
+#else
+    return static_cast<T>(std::islessequal(a, b));
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * Wraps an angle in (-3π, 3π] into (-π, π], e.g. an atan2 result or the difference of two
+ * normalized angles
+ *
+ * Arithmetic only (one correction by ±2π), so loops calling it vectorize (see calculate_track).
+ * Gives the same result as normalize_psi on that range.
+ */
+template<typename T>
+T wrap_psi(T psi) {
+    return psi + T(2 * M_PI) * (detail::less_equal(psi, T(-M_PI)) - detail::greater(psi, T(M_PI)));
+}
+
+/**
+ * Normalize heading angle to be in (-π, π]
+ *
+ * Branch-free for floating point types: a truncation reduces any angle to (-2π, 2π), then
+ * wrap_psi finishes. Loops calling it only vectorize where std::trunc does (Clang, or GCC with
+ * -fno-trapping-math); kernels whose angles are known to be in (-3π, 3π] use wrap_psi.
+ */
+template<typename T>
+T normalize_psi(T psi) {
+    if constexpr (std::is_floating_point<T>::value) {
+        const T two_pi = T(2 * M_PI);
+        return wrap_psi(psi - two_pi * std::trunc(psi / two_pi));
+    } else {
+        while (psi >T(M_PI)) psi -= T(2 * M_PI);
+        while (psi <= T(-M_PI)) psi += T(2 * M_PI);
+        return psi;
+    }
+}
+
+/**
+ * Signed smallest difference a - b between two angles, in (-π, π]
+ */
+template<typename T>
+T angle_diff(T a, T b) {
+    return normalize_psi(a - b);
+}
+
+/**
+ * Wraps s into the lap [s_min, s_min + length) of a closed track
+ *
+ * Uses a floor instead of std::fmod, which is much cheaper and vectorizes. Rounding can
+ * return s_min + length for s just below a lap boundary, which is the end of the closing
+ * segment and therefore the same point as s_min.
+ */
+template<typename T>
+T wrap_s(T s, T s_min, T length) {
+    return s - length * std::floor((s - s_min) / length);
+}
+
+/**
+ * Wraps every s of [first, last) into [s_min, s_min + length), see wrap_s
+ * The division is replaced by a multiplication with the precomputed inverse length.
+ */
+template<typename InputIt, typename OutputIt, typename T>
+OutputIt wrap_s(InputIt first, InputIt last, OutputIt out, T s_min, T length) {
+    const T inv_length = T(1) / length;
+    for (; first != last; ++first) {
+        const T s = *first;
+        *out++ = s - length * std::floor((s - s_min) * inv_length);
+    }
+    return out;
+}
+
 /**
- * Normalize heading angle to be between -π and π
+ * Signed smallest difference a - b between two stations of a closed track of the given
+ * length, in [-length / 2, length / 2)
  */
 template<typename T>
-double normalize_psi(T psi) {
-    while (psi >T(M_PI)) psi -= T(2 * M_PI);
-    while (psi <= T(-M_PI)) psi += T(2 * M_PI);
-    return psi;
+T s_diff(T a, T b, T length) {
+    const T diff = a - b;
+    return diff - length * std::floor(diff / length + T(0.5));
 }
 
 /**
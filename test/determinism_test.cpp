@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track.hpp>
+#include <trajectory_helper/track/fixed_track.hpp>
+#include <trajectory_helper/track/track_batch.hpp>
+#include <trajectory_helper/track/track_cache.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// Set by CMake; the fallback works when running from the repository root
+#ifndef TRAJECTORY_HELPER_TEST_DATA_DIR
+#define TRAJECTORY_HELPER_TEST_DATA_DIR "test/data"
+#endif
+
+/**
+ * Hashes the outputs of calculate, interpolate and project over a corpus of synthetic tracks.
+ *
+ * Every storage (Track2, FixedTrack2, TrackBatch2) must produce bitwise identical results, and
+ * so must repeated runs and batches on any number of threads. These checks always run.
+ *
+ * Comparing against a recorded build is opt-in, since FMA contraction (the default on e.g.
+ * aarch64) and the libm change the hashes. With the TRAJECTORY_HELPER_DETERMINISTIC CMake
+ * option (no contraction) on x86-64 Linux (glibc), the hashes are compared with the committed
+ * test/data/determinism_hashes.txt. Any build can record its own file with
+ * TRAJECTORY_HELPER_DETERMINISM_RECORD=<file> and compare against it with
+ * TRAJECTORY_HELPER_DETERMINISM_REFERENCE=<file>; otherwise the comparison is skipped.
+ */
+
+namespace {
+
+constexpr size_t kCorpusSize = 64;
+constexpr size_t kMaxPoints = 256;
+
+// Portable uniform doubles: std::mt19937 is fully specified, the standard distributions are not
+double uniform(std::mt19937& rng, double min, double max) {
+    return min + (max - min) * (static_cast<double>(rng()) / 4294967296.0);
+}
+
+std::vector<th::Point2d> make_points(size_t k) {
+    std::mt19937 rng(static_cast<std::uint32_t>(1234 + k));
+    const size_t n = 8 + static_cast<size_t>(rng() % (kMaxPoints - 8));
+    const double radius = uniform(rng, 5.0, 100.0);
+    const double wobble = uniform(rng, 0.0, 0.3);
+    std::vector<th::Point2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n) + uniform(rng, -0.1, 0.1) / n;
+        double r = radius * (1.0 + wobble * std::sin(3.0 * phi)) + uniform(rng, -0.05, 0.05);
+        points.emplace_back(r * std::cos(phi), r * std::sin(phi));
+    }
+    return points;
+}
+
+std::vector<th::Point2d> make_queries(size_t k) {
+    std::mt19937 rng(static_cast<std::uint32_t>(9876 + k));
+    std::vector<th::Point2d> queries;
+    for (size_t i = 0; i < 32; ++i) queries.emplace_back(uniform(rng, -150.0, 150.0), uniform(rng, -150.0, 150.0));
+    return queries;
+}
+
+std::uint64_t hash_point(const th::TrackPoint2d& p, std::uint64_t hash) {
+    for (double v : {p.s, p.x, p.y, p.psi, p.kappa, p.wl, p.wr}) hash = th::cache::fnv1a_value(v, hash);
+    return hash;
+}
+
+template<typename It>
+std::uint64_t hash_range(It first, It last, std::uint64_t hash = th::cache::kFnvOffset) {
+    for (; first != last; ++first) hash = hash_point(*first, hash);
+    return hash;
+}
+
+struct Hashes {
+    std::uint64_t calculate = th::cache::kFnvOffset;
+    std::uint64_t interpolate = th::cache::kFnvOffset;
+    std::uint64_t project = th::cache::kFnvOffset;
+};
+
+Hashes hash_track2(bool is_closed) {
+    Hashes hashes;
+    for (size_t k = 0; k < kCorpusSize; ++k) {
+        th::Track2d track(make_points(k));
+        track.calculate(is_closed, 2.0, 2.0, 3.0, 3.0);
+        hashes.calculate = hash_range(track.begin(), track.end(), hashes.calculate);
+
+        th::Track2d resampled = track.interpolate_track(0.7, is_closed);
+        hashes.interpolate = hash_range(resampled.begin(), resampled.end(), hashes.interpolate);
+
+        for (const auto& query : make_queries(k)) hashes.project = hash_point(track.project(query, is_closed), hashes.project);
+    }
+    return hashes;
+}
+
+Hashes hash_fixed_track(bool is_closed) {
+    Hashes hashes;
+    for (size_t k = 0; k < kCorpusSize; ++k) {
+        std::vector<th::Point2d> points = make_points(k);
+        th::FixedTrack2d<4096> track(points.begin(), points.end());
+        track.calculate(is_closed, 2.0, 2.0, 3.0, 3.0);
+        hashes.calculate = hash_range(track.begin(), track.end(), hashes.calculate);
+
+        th::FixedTrack2d<4096> resampled = track.interpolate_track(0.7, is_closed);
+        hashes.interpolate = hash_range(resampled.begin(), resampled.end(), hashes.interpolate);
+
+        for (const auto& query : make_queries(k)) hashes.project = hash_point(track.project(query, is_closed), hashes.project);
+    }
+    return hashes;
+}
+
+Hashes hash_batch(bool is_closed) {
+    th::TrackBatch2d batch;
+    for (size_t k = 0; k < kCorpusSize; ++k) {
+        th::Track2d track(make_points(k));
+        batch.add_track(track);
+    }
+    batch.calculate(is_closed, 2.0, 2.0, 3.0, 3.0);
+    th::TrackBatch2d resampled;
+    batch.interpolate_track(0.7, resampled, is_closed);
+
+    Hashes hashes;
+    for (size_t k = 0; k < batch.size(); ++k) {
+        hashes.calculate = hash_range(batch.begin(k), batch.end(k), hashes.calculate);
+        hashes.interpolate = hash_range(resampled.begin(k), resampled.end(k), hashes.interpolate);
+        for (const auto& query : make_queries(k)) {
+            th::TrackPoint2d projected = th::project_on_track(batch.begin(k), batch.end(k), query, is_closed);
+            hashes.project = hash_point(projected, hashes.project);
+        }
+    }
+    return hashes;
+}
+
+void expect_equal(const Hashes& a, const Hashes& b) {
+    EXPECT_EQ(a.calculate, b.calculate);
+    EXPECT_EQ(a.interpolate, b.interpolate);
+    EXPECT_EQ(a.project, b.project);
+}
+
+}  // namespace
+
+TEST(DeterminismTest, RepeatedRunsAreIdentical) {
+    for (bool is_closed : {true, false}) {
+        expect_equal(hash_track2(is_closed), hash_track2(is_closed));
+        expect_equal(hash_batch(is_closed), hash_batch(is_closed));
+    }
+}
+
+TEST(DeterminismTest, StoragesAreIdentical) {
+    for (bool is_closed : {true, false}) {
+        Hashes reference = hash_track2(is_closed);
+        expect_equal(hash_fixed_track(is_closed), reference);
+        expect_equal(hash_batch(is_closed), reference);
+    }
+}
+
+TEST(DeterminismTest, BatchIsIndependentOfThreadCount) {
+#ifdef _OPENMP
+    const int max_threads = omp_get_max_threads();
+    omp_set_num_threads(1);
+#endif
+    Hashes single_closed = hash_batch(true);
+    Hashes single_open = hash_batch(false);
+#ifdef _OPENMP
+    omp_set_num_threads(std::max(4, max_threads));
+#endif
+    Hashes multi_closed = hash_batch(true);
+    Hashes multi_open = hash_batch(false);
+#ifdef _OPENMP
+    omp_set_num_threads(max_threads);
+#endif
+    expect_equal(multi_closed, single_closed);
+    expect_equal(multi_open, single_open);
+}
+
+TEST(DeterminismTest, MatchesRecordedBuild) {
+    std::map<std::string, std::uint64_t> hashes;
+    for (bool is_closed : {true, false}) {
+        Hashes h = hash_track2(is_closed);
+        const std::string suffix = is_closed ? "_closed" : "_open";
+        hashes["calculate" + suffix] = h.calculate;
+        hashes["interpolate" + suffix] = h.interpolate;
+        hashes["project" + suffix] = h.project;
+    }
+
+    if (const char* path = std::getenv("TRAJECTORY_HELPER_DETERMINISM_RECORD")) {
+        std::ofstream file(path);
+        for (const auto& entry : hashes) file << entry.first << " " << entry.second << "\n";
+    }
+    std::string path;
+    if (const char* reference = std::getenv("TRAJECTORY_HELPER_DETERMINISM_REFERENCE")) {
+        path = reference;
+    } else {
+#if defined(TRAJECTORY_HELPER_DETERMINISM_CHECK) && defined(__x86_64__) && defined(__linux__) && defined(__GLIBC__)
+        path = TRAJECTORY_HELPER_TEST_DATA_DIR "/determinism_hashes.txt";
+#else
+        GTEST_SKIP() << "No reference hashes for this build";
+#endif
+    }
+    std::ifstream file(path);
+    ASSERT_TRUE(file) << "Cannot read " << path;
+    std::string name;
+    std::uint64_t value;
+    size_t compared = 0;
+    while (file >> name >> value) {
+        ASSERT_EQ(hashes.count(name), 1u) << name;
+        EXPECT_EQ(hashes[name], value) << name;
+        ++compared;
+    }
+    EXPECT_EQ(compared, hashes.size());
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,323 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track.hpp>
+#include <trajectory_helper/track/fixed_track.hpp>
+#include <trajectory_helper/track/track_batch.hpp>
+#include <trajectory_helper/track/track_builder.hpp>
+#include <trajectory_helper/track/track_interpolator.hpp>
+#include <trajectory_helper/track/track_point_index.hpp>
+#include <trajectory_helper/track/track_projector.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "reference/track_reference.hpp"
+
+// Differential tests: every fast path against the reference implementations on random tracks
+
+namespace ref = th::reference;
+
+namespace {
+
+constexpr double kTol = 1e-9;
+constexpr double kKappaTol = 1e-7;
+
+struct Case {
+    std::vector<th::TrackPoint2d> points;
+    bool closed;
+};
+
+/**
+ * Random track: a noisy ellipse when closed, a random walk starting at a heading of about π
+ * when open, so psi crosses ±π in both. Some points are duplicated (degenerate segments), and
+ * some closed tracks repeat their first point at the end.
+ */
+Case random_case(std::mt19937& rng, bool closed) {
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    auto uniform = [&](double a, double b) { return a + (b - a) * unit(rng); };
+
+    const size_t n = 8 + static_cast<size_t>(unit(rng) * 140.0);
+    Case c;
+    c.closed = closed;
+
+    double cx = uniform(-50.0, 50.0);
+    double cy = uniform(-50.0, 50.0);
+    double a = uniform(5.0, 40.0);
+    double b = uniform(5.0, 40.0);
+    double phase = uniform(-M_PI, M_PI);
+    double heading = M_PI + uniform(-0.3, 0.3);
+    double x = cx;
+    double y = cy;
+    bool duplicated = false;
+
+    for (size_t i = 0; i < n; ++i) {
+        if (closed) {
+            double phi = phase + 2.0 * M_PI * (static_cast<double>(i) + uniform(-0.3, 0.3)) / static_cast<double>(n);
+            double r = uniform(0.95, 1.05);
+            x = cx + r * a * std::cos(phi);
+            y = cy + r * b * std::sin(phi);
+        } else if (i > 0) {
+            double step = uniform(0.5, 2.0);
+            heading += uniform(-0.4, 0.4);
+            x += step * std::cos(heading);
+            y += step * std::sin(heading);
+        }
+        c.points.emplace_back(x, y, uniform(0.5, 3.0), uniform(0.5, 3.0));
+
+        // Never three equal points in a row and never at the ends, so every window has a
+        // positive path length
+        if (!duplicated && i > 0 && i + 1 < n && unit(rng) < 0.1) {
+            c.points.push_back(c.points.back());
+            duplicated = true;
+        } else {
+            duplicated = false;
+        }
+    }
+    if (closed && !duplicated && unit(rng) < 0.3) {
+        c.points.push_back(c.points.front());
+    }
+    return c;
+}
+
+std::vector<Case> random_cases(unsigned seed, size_t count) {
+    std::mt19937 rng(seed);
+    std::vector<Case> cases;
+    for (size_t i = 0; i < count; ++i) {
+        cases.push_back(random_case(rng, i % 2 == 0));
+    }
+    return cases;
+}
+
+std::vector<th::TrackPoint2d> calculated(std::vector<th::TrackPoint2d> points, bool closed) {
+    ref::calculate(points, closed);
+    return points;
+}
+
+double lap_length(const std::vector<th::TrackPoint2d>& points, bool closed) {
+    return closed ? th::track_length(points.begin(), points.end(), true) : 0.0;
+}
+
+template<typename Track>
+void expect_track_near(const Track& track, const std::vector<th::TrackPoint2d>& expected, double tol, double kappa_tol) {
+    ASSERT_EQ(track.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+        EXPECT_TRUE(ref::points_near(track[i], expected[i], tol, kappa_tol)) << "point " << i;
+    }
+}
+
+}  // namespace
+
+TEST(DifferentialTest, Calculate) {
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> stepsize(0.5, 4.0);
+    for (const auto& c : random_cases(11, 200)) {
+        double pp = stepsize(rng), pr = stepsize(rng), cp = stepsize(rng), cr = stepsize(rng);
+        auto expected = c.points;
+        ref::calculate(expected, c.closed, pp, pr, cp, cr);
+
+        th::Track2d track(c.points);
+        track.calculate(c.closed, pp, pr, cp, cr);
+        expect_track_near(track, expected, kTol, kKappaTol);
+
+        th::FixedTrack2<double, 512> fixed(c.points.begin(), c.points.end());
+        fixed.calculate(c.closed, pp, pr, cp, cr);
+        expect_track_near(fixed, expected, kTol, kKappaTol);
+    }
+}
+
+TEST(DifferentialTest, CalculateFastMath) {
+    for (const auto& c : random_cases(12, 200)) {
+        auto expected = calculated(c.points, c.closed);
+        th::Track2d track(c.points);
+        track.calculate<th::FastMath>(c.closed);
+
+        // FastMath::atan2 is accurate to 2e-6 rad; windows are at least 0.5 m long
+        ASSERT_EQ(track.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            EXPECT_TRUE(ref::near(track[i].s, expected[i].s, kTol)) << "point " << i;
+            EXPECT_TRUE(ref::psi_near(track[i].psi, expected[i].psi, 1e-5)) << "point " << i;
+            EXPECT_TRUE(ref::near(track[i].kappa, expected[i].kappa, 1e-4)) << "point " << i;
+        }
+    }
+}
+
+TEST(DifferentialTest, CalculateBatch) {
+    auto cases = random_cases(13, 200);
+    for (bool closed : {true, false}) {
+        th::TrackBatch2d batch;
+        std::vector<const Case*> members;
+        for (const auto& c : cases) {
+            if (c.closed != closed) continue;
+            batch.add_track(c.points.begin(), c.points.end());
+            members.push_back(&c);
+        }
+        batch.calculate(closed);
+        for (size_t i = 0; i < batch.size(); ++i) {
+            expect_track_near(batch.track(i), calculated(members[i]->points, closed), kTol, kKappaTol);
+        }
+    }
+}
+
+TEST(DifferentialTest, Builder) {
+    std::mt19937 rng(2);
+    std::uniform_int_distribution<size_t> step(1, 4);
+    for (const auto& c : random_cases(14, 200)) {
+        size_t pp = step(rng), pr = step(rng), cp = step(rng), cr = step(rng);
+        th::TrackBuilder2d builder(pp, pr, cp, cr);
+        for (const auto& p : c.points) {
+            builder.append(p);
+        }
+
+        auto expected_open = c.points;
+        ref::calculate_steps(expected_open, false, pp, pr, cp, cr);
+        expect_track_near(builder.snapshot(), expected_open, kTol, kKappaTol);
+
+        builder.close_loop();
+        auto expected_closed = c.points;
+        ref::calculate_steps(expected_closed, true, pp, pr, cp, cr);
+        expect_track_near(builder.track(), expected_closed, kTol, kKappaTol);
+    }
+}
+
+TEST(DifferentialTest, Interpolate) {
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for (const auto& c : random_cases(15, 200)) {
+        auto points = calculated(c.points, c.closed);
+        th::Track2d track(points);
+        th::TrackInterpolator2d interpolator(track, c.closed, th::InterpolationMode::Linear);
+        const double length = th::track_length(track.begin(), track.end(), c.closed);
+        const double lap = lap_length(points, c.closed);
+
+        // Sorted random queries (several laps on closed tracks) for the cursor of the interpolator
+        std::vector<double> queries;
+        for (size_t k = 0; k < 100; ++k) {
+            queries.push_back(c.closed ? (3.0 * unit(rng) - 1.0) * length : unit(rng) * length);
+        }
+        std::sort(queries.begin(), queries.end());
+        queries.push_back(c.closed ? 0.0 : length);
+
+        std::vector<th::TrackPoint2d> batch = track.interpolate(queries, c.closed);
+        std::vector<th::TrackPoint2d> linear(queries.size());
+        interpolator.interpolate(queries.begin(), queries.end(), linear.begin());
+
+        for (size_t k = 0; k < queries.size(); ++k) {
+            auto expected = ref::interpolate(points, queries[k], c.closed);
+            EXPECT_TRUE(ref::points_near(batch[k], expected, kTol, kKappaTol, lap)) << "s = " << queries[k];
+            EXPECT_TRUE(ref::points_near(track.interpolate(queries[k], c.closed), expected, kTol, kKappaTol, lap)) << "s = " << queries[k];
+            EXPECT_TRUE(ref::points_near(linear[k], expected, kTol, kKappaTol, lap)) << "s = " << queries[k];
+            EXPECT_TRUE(ref::points_near(interpolator.interpolate(queries[k]), expected, kTol, kKappaTol, lap)) << "s = " << queries[k];
+        }
+
+        // Exact stations, where the lower bound search of Track2 matters
+        for (const auto& p : points) {
+            EXPECT_TRUE(ref::points_near(track.interpolate(p.s, c.closed), ref::interpolate(points, p.s, c.closed), kTol, kKappaTol, lap));
+        }
+
+        if (!c.closed) {
+            EXPECT_THROW(ref::interpolate(points, length + 1.0, false), std::runtime_error);
+            EXPECT_THROW(track.interpolate(length + 1.0, false), std::runtime_error);
+            EXPECT_THROW(interpolator.interpolate(-1.0), std::runtime_error);
+        }
+    }
+}
+
+TEST(DifferentialTest, InterpolateTrack) {
+    std::mt19937 rng(4);
+    std::uniform_real_distribution<double> stepsize(0.3, 2.0);
+    auto cases = random_cases(16, 100);
+    for (bool closed : {true, false}) {
+        // One stepsize per batch, shared by all its tracks
+        double step = stepsize(rng);
+        th::TrackBatch2d batch;
+        std::vector<std::vector<th::TrackPoint2d>> expected;
+        for (const auto& c : cases) {
+            if (c.closed != closed) continue;
+            auto points = calculated(c.points, closed);
+            expected.push_back(ref::interpolate_track(points, step, closed));
+            batch.add_track(points.begin(), points.end());
+
+            th::Track2d track(points);
+            expect_track_near(track.interpolate_track(step, closed), expected.back(), kTol, kKappaTol);
+        }
+
+        th::TrackBatch2d resampled = batch.interpolate_track(step, closed);
+        ASSERT_EQ(resampled.size(), expected.size());
+        for (size_t i = 0; i < resampled.size(); ++i) {
+            expect_track_near(resampled.track(i), expected[i], kTol, kKappaTol);
+        }
+    }
+}
+
+TEST(DifferentialTest, Project) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for (const auto& c : random_cases(17, 200)) {
+        auto points = calculated(c.points, c.closed);
+        th::Track2d track(points);
+        th::FixedTrack2<double, 512> fixed(points.begin(), points.end());
+        th::TrackProjector2d projector(track, c.closed);
+        const double lap = lap_length(points, c.closed);
+
+        // Points near the track in track order (a vehicle stream), far points and the vertices
+        std::vector<th::Point2d> queries;
+        for (size_t i = 0; i < points.size(); ++i) {
+            queries.emplace_back(points[i].x + 6.0 * unit(rng) - 3.0, points[i].y + 6.0 * unit(rng) - 3.0);
+        }
+        for (size_t k = 0; k < 20; ++k) {
+            queries.emplace_back(400.0 * unit(rng) - 200.0, 400.0 * unit(rng) - 200.0);
+        }
+        for (const auto& p : points) {
+            queries.push_back(p.to_point());
+        }
+
+        std::vector<th::TrackPoint2d> streamed(queries.size());
+        projector.project(queries.begin(), queries.end(), streamed.begin());
+        th::TrackProjector2d::Context ctx;
+
+        for (size_t k = 0; k < queries.size(); ++k) {
+            const auto& q = queries[k];
+            double expected_distance = 0.0;
+            auto expected = ref::project(points, q, c.closed, &expected_distance);
+
+            EXPECT_TRUE(ref::points_near(track.project(q, c.closed), expected, kTol, kKappaTol, lap)) << "query " << k;
+            EXPECT_TRUE(ref::points_near(fixed.project(q, c.closed), expected, kTol, kKappaTol, lap)) << "query " << k;
+            EXPECT_TRUE(ref::points_near(projector.project(q), expected, kTol, kKappaTol, lap)) << "query " << k;
+            EXPECT_TRUE(ref::points_near(projector.project(q, ctx), expected, kTol, kKappaTol, lap)) << "query " << k;
+            EXPECT_TRUE(ref::points_near(streamed[k], expected, kTol, kKappaTol, lap)) << "query " << k;
+            EXPECT_TRUE(ref::near(projector.project_segment(q).distance, expected_distance, kTol)) << "query " << k;
+        }
+    }
+}
+
+TEST(DifferentialTest, NearestPoints) {
+    std::mt19937 rng(6);
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    for (const auto& c : random_cases(18, 100)) {
+        th::Track2d track(c.points);
+        th::TrackPointIndex2d index(track);
+
+        for (size_t q = 0; q < 50; ++q) {
+            // Half of the queries sit on a track point, where duplicates tie
+            th::Point2d point = q % 2 == 0
+                ? c.points[static_cast<size_t>(unit(rng) * static_cast<double>(c.points.size() - 1))].to_point()
+                : th::Point2d(200.0 * unit(rng) - 100.0, 200.0 * unit(rng) - 100.0);
+
+            for (size_t k : {size_t(1), size_t(3), size_t(10), c.points.size() + 5}) {
+                auto expected = ref::k_nearest(c.points, point, k);
+                EXPECT_EQ(index.k_nearest(point, k), expected) << "k = " << k;
+                EXPECT_EQ(th::find_k_nearest_idx(track, point, k), expected) << "k = " << k;
+            }
+            EXPECT_EQ(th::find_nearest_idx(track, point), ref::k_nearest(c.points, point, 1).front());
+
+            double radius = 0.5 + 10.0 * unit(rng);
+            auto expected = ref::within_radius(c.points, point, radius);
+            EXPECT_EQ(index.within_radius(point, radius), expected);
+            EXPECT_EQ(th::find_within_radius_idx(track, point, radius), expected);
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/fixed_track.hpp>
+#include <trajectory_helper/track/track.hpp>
+#include <array>
+#include <cmath>
+
+TEST(FixedTrack2Test, DefaultConstructor) {
+    constexpr th::FixedTrack2d<8> track;
+    static_assert(track.empty(), "default constructed track must be empty");
+    static_assert(th::FixedTrack2d<8>::capacity() == 8, "capacity is the template parameter");
+    EXPECT_EQ(track.size(), 0);
+}
+
+TEST(FixedTrack2Test, CapacityExceeded) {
+    th::FixedTrack2d<2> track = {
+        th::TrackPoint2d(0.0, 0.0),
+        th::TrackPoint2d(1.0, 0.0)
+    };
+    EXPECT_THROW(track.push_back(th::TrackPoint2d(1.0, 1.0)), std::length_error);
+}
+
+TEST(FixedTrack2Test, MatchesTrack2) {
+    std::vector<th::TrackPoint2d> points = {
+        th::TrackPoint2d(0.0, 0.0),
+        th::TrackPoint2d(1.0, 0.0),
+        th::TrackPoint2d(1.0, 1.0),
+        th::TrackPoint2d(0.0, 1.0)
+    };
+    th::Track2d track(points);
+    track.calculate(true);
+
+    th::FixedTrack2d<16> fixed_track(points.begin(), points.end());
+    fixed_track.calculate(true);
+
+    ASSERT_EQ(fixed_track.size(), track.size());
+    for (size_t i = 0; i < track.size(); ++i) {
+        EXPECT_EQ(fixed_track[i].s, track[i].s);
+        EXPECT_EQ(fixed_track[i].psi, track[i].psi);
+        EXPECT_EQ(fixed_track[i].kappa, track[i].kappa);
+    }
+
+    std::array<double, 5> s_query = {0.5, 3.0, 3.5, 4.5, -0.5};
+    std::array<th::TrackPoint2d, 5> interpolated;
+    fixed_track.interpolate(s_query.begin(), s_query.end(), interpolated.begin(), true);
+    std::vector<double> s_query_vec(s_query.begin(), s_query.end());
+    std::vector<th::TrackPoint2d> expected = track.interpolate(s_query_vec, true);
+    for (size_t i = 0; i < s_query.size(); ++i) {
+        EXPECT_EQ(interpolated[i].s, expected[i].s);
+        EXPECT_EQ(interpolated[i].x, expected[i].x);
+        EXPECT_EQ(interpolated[i].y, expected[i].y);
+    }
+
+    th::Point2d point(-1.0, 0.2);
+    th::TrackPoint2d projected = fixed_track.project(point, true);
+    EXPECT_NEAR(projected.s, 3.8, 1e-10);
+    EXPECT_NEAR(projected.x, 0.0, 1e-10);
+    EXPECT_NEAR(projected.y, 0.2, 1e-10);
+
+    std::array<double, 4> s_values;
+    fixed_track.s(s_values.begin());
+    EXPECT_EQ(s_values[3], 3.0);
+}
+
+TEST(FixedTrack2Test, InterpolateTrack) {
+    th::FixedTrack2d<16> track = {
+        th::TrackPoint2d(0.0, 0.0),
+        th::TrackPoint2d(1.0, 0.0),
+        th::TrackPoint2d(1.0, 1.0),
+        th::TrackPoint2d(0.0, 1.0)
+    };
+    track.calculate(true);
+
+    th::FixedTrack2d<16> interp_track_half = track.interpolate_track(0.5, true);
+    EXPECT_EQ(interp_track_half.size(), 8);
+    EXPECT_TRUE(interp_track_half.has_kappa());
+
+    EXPECT_EQ(track.interpolate_track(0.25, true).size(), 16);
+    EXPECT_THROW(track.interpolate_track(0.2, true), std::length_error);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
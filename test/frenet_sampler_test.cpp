@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/frenet/frenet_sampler.hpp>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+th::Track2d make_line(size_t n, double spacing) {
+    std::vector<th::TrackPoint2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        points.emplace_back(spacing * static_cast<double>(i), 0.0, 2.0, 2.0);
+    }
+    th::Track2d track(points);
+    track.calculate(false);
+    return track;
+}
+
+th::Track2d make_circle(double radius, size_t n) {
+    std::vector<th::TrackPoint2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        points.emplace_back(radius * std::cos(phi), radius * std::sin(phi));
+    }
+    th::Track2d track(points);
+    track.calculate(true);
+    return track;
+}
+
+th::FrenetCandidate<double> candidate(double s, double s_d, double d, double duration) {
+    th::FrenetCandidate<double> c;
+    c.end.s = s;
+    c.end.s_d = s_d;
+    c.end.d = d;
+    c.duration = duration;
+    return c;
+}
+
+}  // namespace
+
+TEST(FrenetSamplerTest, QuinticBoundaryConditions) {
+    th::QuinticPolynomial<double> poly(1.0, 2.0, 0.5, 10.0, -1.0, 0.25, 3.0);
+    EXPECT_NEAR(poly(0.0), 1.0, 1e-12);
+    EXPECT_NEAR(poly.derivative(0.0), 2.0, 1e-12);
+    EXPECT_NEAR(poly.second_derivative(0.0), 0.5, 1e-12);
+    EXPECT_NEAR(poly(3.0), 10.0, 1e-9);
+    EXPECT_NEAR(poly.derivative(3.0), -1.0, 1e-9);
+    EXPECT_NEAR(poly.second_derivative(3.0), 0.25, 1e-9);
+    EXPECT_THROW(th::QuinticPolynomial<double>(0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0), std::runtime_error);
+}
+
+TEST(FrenetSamplerTest, LaneChangeOnStraightLine) {
+    th::Track2d reference = make_line(51, 1.0);
+    th::FrenetSampler2d sampler(reference, false);
+
+    th::FrenetState<double> start;
+    start.s_d = 10.0;
+    std::vector<th::FrenetCandidate<double>> candidates = {
+        candidate(20.0, 10.0, 1.0, 2.0),
+        candidate(20.0, 10.0, -1.0, 2.0),
+        candidate(15.0, 5.0, 0.0, 2.0)
+    };
+    th::TrackBatch2d out;
+    sampler.sample(start, candidates.begin(), candidates.end(), 41, out);
+
+    ASSERT_EQ(out.size(), 3);
+    ASSERT_EQ(out.track_size(0), 41);
+    const th::TrackPoint2d& end_left = out.end(0)[-1];
+    EXPECT_NEAR(end_left.x, 20.0, 1e-9);
+    EXPECT_NEAR(end_left.y, 1.0, 1e-9);
+    EXPECT_NEAR(end_left.psi, 0.0, 1e-9);
+    EXPECT_NEAR(end_left.wl, 1.0, 1e-9);
+    EXPECT_NEAR(end_left.wr, 3.0, 1e-9);
+    EXPECT_NEAR(out.end(1)[-1].y, -1.0, 1e-9);
+    EXPECT_NEAR(out.end(2)[-1].x, 15.0, 1e-9);
+
+    // Lane change bends left first, then right
+    EXPECT_GT(out.begin(0)[5].kappa, 0.0);
+    EXPECT_LT(out.begin(0)[35].kappa, 0.0);
+    EXPECT_GT(out.begin(0)[20].psi, 0.0);
+
+    // s is the Cartesian path length, slightly longer than the station for the lane change
+    EXPECT_EQ(out.begin(0)[0].s, 0.0);
+    EXPECT_GT(end_left.s, 20.0);
+    EXPECT_LT(end_left.s, 20.2);
+    EXPECT_NEAR(sampler.sampled_s()[40], 20.0, 1e-9);
+    EXPECT_NEAR(sampler.sampled_d()[40], 1.0, 1e-9);
+}
+
+TEST(FrenetSamplerTest, ConstantOffsetOnCircle) {
+    const double radius = 20.0;
+    th::Track2d reference = make_circle(radius, 400);
+    th::FrenetSampler2d sampler(reference, true);
+    const double length = th::track_length(reference.begin(), reference.end(), true);
+
+    // Drives across the seam at a constant offset of 2 to the left (towards the center)
+    th::FrenetState<double> start;
+    start.s = length - 10.0;
+    start.s_d = 10.0;
+    start.d = 2.0;
+    std::vector<th::FrenetCandidate<double>> candidates = {candidate(length + 10.0, 10.0, 2.0, 2.0)};
+    th::TrackBatch2d out;
+    sampler.sample(start, candidates.begin(), candidates.end(), 50, out);
+
+    for (size_t k = 0; k < out.track_size(0); ++k) {
+        const auto& p = out.begin(0)[k];
+        EXPECT_NEAR(std::hypot(p.x, p.y), radius - 2.0, 1e-3);
+        EXPECT_NEAR(p.kappa, 1.0 / (radius - 2.0), 1e-3);
+        EXPECT_NEAR(th::angle_diff(p.psi, std::atan2(p.y, p.x) + M_PI / 2), 0.0, 1e-3);
+    }
+}
+
+TEST(FrenetSamplerTest, ReuseKeepsResultsConsistent) {
+    th::Track2d reference = make_line(51, 1.0);
+    th::FrenetSampler2d sampler(reference, false);
+    th::FrenetState<double> start;
+    start.s_d = 5.0;
+
+    std::vector<th::FrenetCandidate<double>> candidates;
+    for (int i = 0; i < 100; ++i) {
+        candidates.push_back(candidate(10.0 + 0.1 * i, 5.0, -1.0 + 0.02 * i, 2.0 + 0.01 * i));
+    }
+    th::TrackBatch2d first;
+    th::TrackBatch2d second;
+    sampler.sample(start, candidates.begin(), candidates.end(), 20, first);
+    sampler.sample(start, candidates.begin(), candidates.end(), 20, second);
+    EXPECT_EQ(first.num_points(), 100 * 20);
+    for (size_t i = 0; i < first.num_points(); ++i) {
+        EXPECT_EQ(first.points()[i].x, second.points()[i].x);
+        EXPECT_EQ(first.points()[i].kappa, second.points()[i].kappa);
+    }
+}
+
+TEST(FrenetSamplerTest, UncalculatedReferenceThrows) {
+    std::vector<th::TrackPoint2d> points = {th::TrackPoint2d(0.0, 0.0), th::TrackPoint2d(1.0, 0.0)};
+    th::Track2d reference(points);
+    EXPECT_THROW(th::FrenetSampler2d sampler(reference), std::runtime_error);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,95 @@
+#define TRAJECTORY_HELPER_INSTRUMENTATION 1
+
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track.hpp>
+#include <trajectory_helper/frenet/frenet_sampler.hpp>
+#include <sstream>
+
+namespace ti = th::instrumentation;
+
+namespace {
+
+th::Track2d make_square() {
+    std::vector<th::TrackPoint2d> points = {
+        th::TrackPoint2d(0.0, 0.0),
+        th::TrackPoint2d(1.0, 0.0),
+        th::TrackPoint2d(1.0, 1.0),
+        th::TrackPoint2d(0.0, 1.0)
+    };
+    return th::Track2d(points);
+}
+
+}  // namespace
+
+TEST(InstrumentationTest, CountsCallsAndPoints) {
+    ti::reset();
+
+    th::Track2d track = make_square();
+    track.calculate(true);
+    track.interpolate(std::vector<double>{0.5, 1.5, 2.5}, true);
+    track.interpolate(0.5, true);
+    track.project(th::Point2d(0.5, -1.0), true);
+    th::Track2d resampled = track.interpolate_track(0.5, true);
+
+    ti::Snapshot snapshot = ti::snapshot();
+    // interpolate_track calculates the resampled track as well
+    EXPECT_EQ(snapshot[ti::Api::Calculate].calls, 2);
+    EXPECT_EQ(snapshot[ti::Api::Calculate].points, 4 + resampled.size());
+    EXPECT_EQ(snapshot[ti::Api::Interpolate].calls, 2);
+    EXPECT_EQ(snapshot[ti::Api::Interpolate].points, 4);
+    EXPECT_EQ(snapshot[ti::Api::Project].calls, 1);
+    EXPECT_EQ(snapshot[ti::Api::Project].points, 4);
+    EXPECT_EQ(snapshot[ti::Api::InterpolateTrack].calls, 1);
+    EXPECT_GE(snapshot[ti::Api::Calculate].total_ns, snapshot[ti::Api::Calculate].max_ns);
+
+    ti::reset();
+    EXPECT_EQ(ti::snapshot()[ti::Api::Calculate].calls, 0);
+}
+
+TEST(InstrumentationTest, FrenetSamplerHasItsOwnApi) {
+    th::Track2d reference = make_square();
+    reference.calculate(true);
+    th::FrenetSampler2d sampler(reference, true);
+    std::vector<th::FrenetCandidate<double>> candidates(3);
+    th::TrackBatch2d out;
+
+    ti::reset();
+    sampler.sample(th::FrenetState<double>(), candidates.begin(), candidates.end(), 10, out);
+
+    ti::Snapshot snapshot = ti::snapshot();
+    EXPECT_EQ(snapshot[ti::Api::FrenetSample].calls, 1);
+    EXPECT_EQ(snapshot[ti::Api::FrenetSample].points, 30);
+    EXPECT_EQ(snapshot[ti::Api::Interpolate].calls, 0);
+    EXPECT_STREQ(ti::api_name(ti::Api::FrenetSample), "frenet_sample");
+}
+
+TEST(InstrumentationTest, ChromeTrace) {
+    ti::reset();
+    ti::set_trace_enabled(true);
+
+    th::Track2d track = make_square();
+    track.calculate(true);
+    track.project(th::Point2d(0.5, -1.0), true);
+
+    ti::set_trace_enabled(false);
+    track.calculate(true);
+
+    std::ostringstream os;
+    ti::write_chrome_trace(os);
+    std::string trace = os.str();
+
+    EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0);
+    EXPECT_NE(trace.find("\"name\":\"calculate\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"project\""), std::string::npos);
+    // Only the two calls made while tracing was enabled are recorded
+    size_t events = 0;
+    for (size_t pos = trace.find("\"ph\":\"X\""); pos != std::string::npos; pos = trace.find("\"ph\":\"X\"", pos + 1)) {
+        ++events;
+    }
+    EXPECT_EQ(events, 2);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/math_kernels.hpp>
+#include <trajectory_helper/track/track.hpp>
+#include <cmath>
+#include <type_traits>
+
+TEST(MathKernelsTest, GenericHelpers) {
+    static_assert(std::is_same<decltype(th::distance(th::Point2f(), th::Point2f())), float>::value, "float distance");
+    static_assert(std::is_same<decltype(th::distance(th::Point2d(), th::Point2d())), double>::value, "double distance");
+    static_assert(std::is_same<decltype(th::normalize_psi(1.0f)), float>::value, "float normalize_psi");
+
+    th::Point2d p1(0.0, 0.0);
+    th::Point2d p2(1.0 + 1e-9, 0.0);
+    EXPECT_NE(th::distance(p1, p2), 1.0);  // no longer rounded through float
+}
+
+TEST(MathKernelsTest, FastAtan2ErrorBound) {
+    const int n = 100000;
+    double max_error_double = 0.0;
+    double max_error_float = 0.0;
+    for (int i = 0; i < n; ++i) {
+        double phi = -M_PI + 2 * M_PI * i / n;
+        for (double radius : {1e-3, 1.0, 1e4}) {
+            double x = radius * std::cos(phi);
+            double y = radius * std::sin(phi);
+            double error_double = th::normalize_psi(th::FastMath::atan2(y, x) - std::atan2(y, x));
+            float error_float = th::normalize_psi(th::FastMath::atan2(float(y), float(x)) - std::atan2(float(y), float(x)));
+            max_error_double = std::max(max_error_double, std::abs(error_double));
+            max_error_float = std::max(max_error_float, double(std::abs(error_float)));
+        }
+    }
+    EXPECT_LT(max_error_double, 2e-6);
+    EXPECT_LT(max_error_float, 3e-6);
+
+    EXPECT_EQ(th::FastMath::atan2(0.0, 0.0), 0.0);
+    EXPECT_NEAR(th::FastMath::atan2(0.0, -1.0), M_PI, 1e-12);
+    EXPECT_NEAR(th::FastMath::atan2(1.0, 0.0), M_PI / 2, 1e-12);
+}
+
+TEST(MathKernelsTest, FastFloatCalculateMatchesDoubleReference) {
+    std::vector<th::Point2d> points_d;
+    std::vector<th::Point2f> points_f;
+    for (int i = 0; i < 500; ++i) {
+        double phi = 2 * M_PI * i / 500;
+        double r = 100.0 + 10.0 * std::sin(3 * phi);
+        points_d.emplace_back(r * std::cos(phi), r * std::sin(phi));
+        points_f.emplace_back(float(r * std::cos(phi)), float(r * std::sin(phi)));
+    }
+
+    th::Track2d reference(points_d);
+    reference.calculate(true, 3.0, 3.0, 3.0, 3.0);
+    th::Track2f fast(points_f);
+    fast.calculate<th::FastMath>(true, 3.0, 3.0, 3.0, 3.0);
+
+    for (size_t i = 0; i < reference.size(); ++i) {
+        EXPECT_NEAR(fast[i].s, reference[i].s, 1e-3 * reference[i].s + 1e-4);
+        EXPECT_NEAR(th::normalize_psi(double(fast[i].psi) - reference[i].psi), 0.0, 1e-5);
+        EXPECT_NEAR(fast[i].kappa, reference[i].kappa, 1e-4);
+    }
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
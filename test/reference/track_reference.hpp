@@ -0,0 +1,381 @@
+#ifndef TRAJECTORY_HELPER__TEST__REFERENCE__TRACK_REFERENCE_HPP
+#define TRAJECTORY_HELPER__TEST__REFERENCE__TRACK_REFERENCE_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <trajectory_helper/utils.hpp>
+#include <trajectory_helper/point/point.hpp>
+#include <trajectory_helper/track/track_point.hpp>
+
+namespace th {
+namespace reference {
+
+/**
+ * Reference implementations of the track algorithms, the oracle of the differential tests
+ * (test/differential_test.cpp) and the fuzzer (fuzz/track_fuzzer.cpp).
+ *
+ * They are the original Track2 member functions written as free functions over a plain point
+ * vector: element lengths in a separate vector, path lengths summed element by element,
+ * modular indices everywhere, copies with the first point appended for closed tracks and a
+ * linear scan over all segments. Nothing here is optimized and nothing may be: every fast path
+ * must agree with this code within floating point tolerance.
+ *
+ * The only deviations from the original code are the semantic fixes made since:
+ * - psi is blended through the wrapped difference (angle_diff), so it stays continuous
+ *   across ±π
+ * - open tracks clamp the psi/kappa windows at the ends instead of always using ±1 points
+ * - a closed window spanning the whole lap has the full lap as path length
+ * - projections interpolate wr between the segment end points
+ */
+
+template<typename T>
+using Points = std::vector<TrackPoint2<T>>;
+
+// Window of stepsize in index steps, at least 1
+template<typename T>
+size_t index_step(double stepsize, T avg_el_length) {
+    T steps = std::round(static_cast<T>(stepsize) / avg_el_length);
+    if (!(steps >= T(1))) {
+        return 1;
+    }
+    return static_cast<size_t>(std::min(steps, static_cast<T>(std::numeric_limits<int>::max())));
+}
+
+/**
+ * Calculates s, psi and kappa with windows given in index steps
+ */
+template<typename T>
+void calculate_steps(
+    Points<T>& track,
+    bool is_closed,
+    size_t step_preview_psi,
+    size_t step_review_psi,
+    size_t step_preview_curv,
+    size_t step_review_curv,
+    bool calc_curv = true)
+{
+    const size_t n = track.size();
+    if (n < 2) {
+        throw std::runtime_error("Track must have at least 2 points!");
+    }
+
+    std::vector<T> el_lengths;
+    for (size_t i = 0; i + 1 < n; ++i) {
+        el_lengths.push_back(distance(track[i], track[i + 1]));
+    }
+    if (is_closed) {
+        el_lengths.push_back(distance(track.back(), track.front()));
+    }
+
+    track[0].s = T();
+    for (size_t i = 1; i < n; ++i) {
+        track[i].s = track[i - 1].s + el_lengths[i - 1];
+    }
+
+    auto preview = [&](size_t i, size_t step) {
+        return is_closed ? (i + step) % n : std::min(i + step, n - 1);
+    };
+    auto review = [&](size_t i, size_t step) {
+        return is_closed ? (i + n - step % n) % n : (i > step ? i - step : 0);
+    };
+
+    for (size_t i = 0; i < n; ++i) {
+        const auto& p2 = track[preview(i, step_preview_psi)];
+        const auto& p1 = track[review(i, step_review_psi)];
+        track[i].psi = normalize_psi(std::atan2(p2.y - p1.y, p2.x - p1.x));
+    }
+
+    if (!calc_curv) {
+        return;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        size_t preview_idx = preview(i, step_preview_curv);
+        size_t review_idx = review(i, step_review_curv);
+        T delta_psi = normalize_psi(track[preview_idx].psi - track[review_idx].psi);
+
+        T path_length = T();
+        if (is_closed) {
+            // At least one element: a window spanning the whole lap covers all of it
+            size_t j = review_idx;
+            do {
+                path_length += el_lengths[j];
+                j = (j + 1) % n;
+            } while (j != preview_idx);
+        } else {
+            for (size_t j = review_idx; j < preview_idx; ++j) {
+                path_length += el_lengths[j];
+            }
+        }
+        track[i].kappa = delta_psi / path_length;
+    }
+}
+
+/**
+ * Calculates s, psi and kappa with windows given in meters (see Track2::calculate)
+ */
+template<typename T>
+void calculate(
+    Points<T>& track,
+    bool is_closed = true,
+    double stepsize_psi_preview = 1.0,
+    double stepsize_psi_review = 1.0,
+    double stepsize_curv_preview = 1.0,
+    double stepsize_curv_review = 1.0,
+    bool calc_curv = true)
+{
+    if (track.size() < 2) {
+        throw std::runtime_error("Track must have at least 2 points!");
+    }
+    std::vector<T> el_lengths;
+    for (size_t i = 0; i + 1 < track.size(); ++i) {
+        el_lengths.push_back(distance(track[i], track[i + 1]));
+    }
+    if (is_closed) {
+        el_lengths.push_back(distance(track.back(), track.front()));
+    }
+    T avg_el_length = std::accumulate(el_lengths.begin(), el_lengths.end(), T()) / static_cast<T>(el_lengths.size());
+
+    calculate_steps(track, is_closed,
+        index_step(stepsize_psi_preview, avg_el_length),
+        index_step(stepsize_psi_review, avg_el_length),
+        index_step(stepsize_curv_preview, avg_el_length),
+        index_step(stepsize_curv_review, avg_el_length),
+        calc_curv);
+}
+
+/**
+ * Interpolates a calculated track at s_query (see Track2::interpolate)
+ */
+template<typename T>
+TrackPoint2<T> interpolate(const Points<T>& points, T s_query, bool is_closed = true) {
+    if (points.empty()) {
+        throw std::runtime_error("Track is empty!");
+    }
+
+    Points<T> track = points;
+    if (is_closed) {
+        // Add the first point to the end of the track to handle wrap-around
+        track.push_back(points.front());
+        track.back().s = points.back().s + distance(points.back(), points.front());
+    }
+
+    T s_min = track.front().s;
+    T s_max = track.back().s;
+    if (is_closed) {
+        if (s_query < s_min || s_query >= s_max) {
+            s_query = s_min + std::fmod(std::fmod(s_query - s_min, s_max - s_min) + (s_max - s_min), s_max - s_min);
+        }
+    } else if (s_query < s_min || s_query > s_max) {
+        throw std::runtime_error("Query s is out of track range!");
+    }
+
+    size_t idx = 0;
+    while (idx < track.size() && track[idx].s < s_query) {
+        ++idx;
+    }
+    if (idx == 0) {
+        return track.front();
+    }
+    if (idx >= track.size()) {
+        return track.back();
+    }
+
+    const auto& p1 = track[idx - 1];
+    const auto& p2 = track[idx];
+    T alpha = (s_query - p1.s) / (p2.s - p1.s);
+
+    TrackPoint2<T> interpolated;
+    interpolated.s = s_query;
+    interpolated.x = p1.x + alpha * (p2.x - p1.x);
+    interpolated.y = p1.y + alpha * (p2.y - p1.y);
+    interpolated.psi = normalize_psi(p1.psi + alpha * normalize_psi(p2.psi - p1.psi));
+    interpolated.kappa = p1.kappa + alpha * (p2.kappa - p1.kappa);
+    interpolated.wl = p1.wl + alpha * (p2.wl - p1.wl);
+    interpolated.wr = p1.wr + alpha * (p2.wr - p1.wr);
+    return interpolated;
+}
+
+/**
+ * Resamples a calculated track every stepsize meters and calculates the result
+ * (see Track2::interpolate_track)
+ */
+template<typename T>
+Points<T> interpolate_track(const Points<T>& points, T stepsize, bool is_closed = true) {
+    T s_min = points.front().s;
+    T s_max = points.back().s;
+    if (is_closed) {
+        s_max += distance(points.back(), points.front());
+    }
+    size_t n_points = is_closed
+        ? static_cast<size_t>(std::floor((s_max - s_min) / stepsize))
+        : static_cast<size_t>(std::floor((s_max - s_min) / stepsize + 1));
+
+    Points<T> resampled;
+    for (size_t i = 0; i < n_points; ++i) {
+        resampled.push_back(interpolate(points, s_min + i * stepsize, is_closed));
+    }
+    calculate(resampled, is_closed);
+    return resampled;
+}
+
+/**
+ * Closest projection of point onto the track segments; distance_out receives its distance
+ * (see Track2::project)
+ */
+template<typename T>
+TrackPoint2<T> project(const Points<T>& points, const Point2<T>& point, bool is_closed = true, T* distance_out = nullptr) {
+    if (points.size() < 2) {
+        throw std::runtime_error("Track must have at least 2 points!");
+    }
+
+    T min_dist = std::numeric_limits<T>::max();
+    size_t seg_idx1 = 0;
+    T proj_t = 0;
+    Point2<T> proj_point;
+
+    Points<T> track = points;
+    if (is_closed) {
+        track.push_back(points.front());
+        if (points.front().has_s()) {
+            track.back().s = points.back().s + distance(points.back(), points.front());
+        }
+    }
+
+    for (size_t i = 0; i < track.size() - 1; ++i) {
+        const auto& p1 = track[i];
+        const auto& p2 = track[i + 1];
+
+        Point2<T> segment = {p2.x - p1.x, p2.y - p1.y};
+        Point2<T> to_point = {point.x - p1.x, point.y - p1.y};
+        T dot = to_point.x * segment.x + to_point.y * segment.y;
+        T segment_length_sq = segment.x * segment.x + segment.y * segment.y;
+        T t = std::clamp(dot / segment_length_sq, T(0), T(1));
+
+        Point2<T> curr_proj = {p1.x + t * segment.x, p1.y + t * segment.y};
+        T curr_dist = distance(point, curr_proj);
+        if (curr_dist < min_dist) {
+            min_dist = curr_dist;
+            proj_point = curr_proj;
+            seg_idx1 = i;
+            proj_t = t;
+        }
+    }
+
+    const auto& p1 = track[seg_idx1];
+    const auto& p2 = track[seg_idx1 + 1];
+
+    TrackPoint2<T> interpolated;
+    interpolated.x = proj_point.x;
+    interpolated.y = proj_point.y;
+    if (points.front().has_s()) {
+        interpolated.s = p1.s + proj_t * (p2.s - p1.s);
+    }
+    if (points.front().has_psi()) {
+        interpolated.psi = normalize_psi(p1.psi + proj_t * normalize_psi(p2.psi - p1.psi));
+    }
+    if (points.front().has_kappa()) {
+        interpolated.kappa = p1.kappa + proj_t * (p2.kappa - p1.kappa);
+    }
+    if (points.front().has_widths()) {
+        interpolated.wl = p1.wl + proj_t * (p2.wl - p1.wl);
+        interpolated.wr = p1.wr + proj_t * (p2.wr - p1.wr);
+    }
+    if (distance_out) {
+        *distance_out = min_dist;
+    }
+    return interpolated;
+}
+
+/**
+ * Indices of the k closest points by increasing distance, ties by index
+ */
+template<typename T>
+std::vector<size_t> k_nearest(const Points<T>& points, const Point2<T>& point, size_t k) {
+    using D = decltype(distance(points[0], point));
+    std::vector<std::pair<D, size_t>> all;
+    for (size_t i = 0; i < points.size(); ++i) {
+        all.emplace_back(distance(points[i], point), i);
+    }
+    std::sort(all.begin(), all.end());
+
+    std::vector<size_t> nearest;
+    for (size_t i = 0; i < std::min(k, all.size()); ++i) {
+        nearest.push_back(all[i].second);
+    }
+    return nearest;
+}
+
+/**
+ * Indices of all points within radius by increasing distance, ties by index
+ */
+template<typename T>
+std::vector<size_t> within_radius(const Points<T>& points, const Point2<T>& point, T radius) {
+    using D = decltype(distance(points[0], point));
+    std::vector<std::pair<D, size_t>> found;
+    for (size_t i = 0; i < points.size(); ++i) {
+        D dist = distance(points[i], point);
+        if (dist <= radius) {
+            found.emplace_back(dist, i);
+        }
+    }
+    std::sort(found.begin(), found.end());
+
+    std::vector<size_t> indices;
+    for (const auto& item : found) {
+        indices.push_back(item.second);
+    }
+    return indices;
+}
+
+/**
+ * Equality within tolerance; infinities must match exactly and NaN equals NaN, so
+ * degenerate inputs have to fail the same way in both implementations
+ */
+template<typename T>
+bool near(T a, T b, T tol) {
+    if (std::isnan(a) || std::isnan(b)) {
+        return std::isnan(a) && std::isnan(b);
+    }
+    if (std::isinf(a) || std::isinf(b)) {
+        return a == b;
+    }
+    return std::abs(a - b) <= tol * (T(1) + std::max(std::abs(a), std::abs(b)));
+}
+
+// Heading equality across the ±π seam
+template<typename T>
+bool psi_near(T a, T b, T tol) {
+    if (std::isinf(a) || std::isinf(b)) {
+        return std::isinf(a) && std::isinf(b);
+    }
+    return near(angle_diff(a, b), T(), tol);
+}
+
+/**
+ * Track point equality within tolerance. s is compared modulo lap_length when it is positive,
+ * since the seam of a closed track is both s = 0 and s = lap_length.
+ */
+template<typename T>
+bool points_near(const TrackPoint2<T>& a, const TrackPoint2<T>& b, T tol, T kappa_tol, T lap_length = T()) {
+    bool s_ok = lap_length > T() && std::isfinite(a.s) && std::isfinite(b.s)
+        ? near(s_diff(a.s, b.s, lap_length), T(), tol * (T(1) + lap_length))
+        : near(a.s, b.s, tol);
+    return s_ok
+        && near(a.x, b.x, tol)
+        && near(a.y, b.y, tol)
+        && psi_near(a.psi, b.psi, tol)
+        && near(a.kappa, b.kappa, kappa_tol)
+        && near(a.wl, b.wl, tol)
+        && near(a.wr, b.wr, tol);
+}
+
+}  // namespace reference
+}  // namespace th
+
+#endif  // TRAJECTORY_HELPER__TEST__REFERENCE__TRACK_REFERENCE_HPP
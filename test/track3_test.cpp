@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track.hpp>
+#include <trajectory_helper/track/track3.hpp>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+// Open helix of radius r climbing with a constant grade
+th::Track3d make_helix(double r, double grade, size_t n, double sweep) {
+    std::vector<th::Point3d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = sweep * static_cast<double>(i) / static_cast<double>(n - 1);
+        points.emplace_back(r * std::cos(phi), r * std::sin(phi), grade * r * phi);
+    }
+    return th::Track3d(points);
+}
+
+// Closed figure eight crossing itself at the origin, once high (phi = 0) and once low (phi = π)
+th::Track3d make_figure_eight(double a, double h, size_t n) {
+    std::vector<th::Point3d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        points.emplace_back(a * std::sin(phi), a * std::sin(phi) * std::cos(phi), h * std::cos(phi));
+    }
+    th::Track3d track(points);
+    track.calculate(true);
+    return track;
+}
+
+}  // namespace
+
+TEST(Track3Test, FlatTrackMatchesTrack2) {
+    std::vector<th::Point2d> points2;
+    std::vector<th::Point3d> points3;
+    for (size_t i = 0; i < 50; ++i) {
+        double phi = 2.0 * M_PI * static_cast<double>(i) / 50.0;
+        double r = 20.0 + 2.0 * std::sin(3.0 * phi);
+        points2.emplace_back(r * std::cos(phi), r * std::sin(phi));
+        points3.emplace_back(r * std::cos(phi), r * std::sin(phi), 0.0);
+    }
+    th::Track2d track2(points2);
+    th::Track3d track3(points3);
+    track2.calculate(true, 2.0, 2.0, 3.0, 3.0);
+    track3.calculate(true, 2.0, 2.0, 3.0, 3.0);
+
+    for (size_t i = 0; i < track2.size(); ++i) {
+        EXPECT_DOUBLE_EQ(track3[i].s, track2[i].s);
+        EXPECT_DOUBLE_EQ(track3[i].psi, track2[i].psi);
+        EXPECT_DOUBLE_EQ(track3[i].kappa, track2[i].kappa);
+        EXPECT_EQ(track3[i].slope, 0.0);
+        EXPECT_EQ(track3[i].bank, 0.0);
+    }
+    EXPECT_DOUBLE_EQ(th::track_length(track3.begin(), track3.end()), th::track_length(track2.begin(), track2.end()));
+}
+
+TEST(Track3Test, CalculateSlopeOnHelix) {
+    const double grade = 0.1;
+    th::Track3d track = make_helix(30.0, grade, 200, 2.0 * M_PI);
+    track.calculate(false);
+
+    // s runs along the 3D curve: sqrt(1 + grade²) times the horizontal arc
+    EXPECT_NEAR(track.back().s, std::sqrt(1.0 + grade * grade) * 30.0 * 2.0 * M_PI, 1e-2);
+    for (const auto& p : track) {
+        EXPECT_NEAR(p.slope, std::atan(grade), 1e-3);
+    }
+    // Horizontal curvature per unit of 3D arc length; the clamped windows at the ends differ
+    for (size_t i = 2; i + 2 < track.size(); ++i) {
+        EXPECT_NEAR(track[i].kappa, 1.0 / (30.0 * std::sqrt(1.0 + grade * grade)), 1e-4);
+    }
+
+    // Downhill when driven backwards
+    th::Track3d reversed(track.rbegin(), track.rend());
+    reversed.calculate(false);
+    EXPECT_NEAR(reversed[100].slope, -std::atan(grade), 1e-3);
+}
+
+TEST(Track3Test, BankIsKeptAndInterpolated) {
+    th::Track3d track = make_helix(30.0, 0.05, 100, M_PI);
+    std::vector<double> bank;
+    for (size_t i = 0; i < track.size(); ++i) {
+        bank.push_back(0.001 * static_cast<double>(i));
+    }
+    track.set_bank(bank);
+    track.calculate(false);
+    EXPECT_EQ(track.bank(), bank);
+
+    double s = 0.5 * (track[10].s + track[11].s);
+    th::TrackPoint3d p = track.interpolate(s, false);
+    EXPECT_NEAR(p.bank, 0.0105, 1e-12);
+    EXPECT_NEAR(p.z, 0.5 * (track[10].z + track[11].z), 1e-12);
+    EXPECT_NEAR(p.slope, 0.5 * (track[10].slope + track[11].slope), 1e-12);
+    EXPECT_THROW(track.interpolate(track.back().s + 1.0, false), std::runtime_error);
+}
+
+TEST(Track3Test, InterpolateTrackKeepsElevation) {
+    th::Track3d track = make_helix(30.0, 0.1, 60, M_PI);
+    track.calculate(false);
+    th::Track3d resampled = track.interpolate_track(0.5, false);
+
+    ASSERT_GT(resampled.size(), 100u);
+    for (size_t i = 1; i + 1 < resampled.size(); ++i) {
+        EXPECT_NEAR(resampled[i].s - resampled[i - 1].s, 0.5, 1e-3);
+        EXPECT_NEAR(resampled[i].slope, std::atan(0.1), 1e-3);
+        EXPECT_NEAR(std::atan2(resampled[i].y, resampled[i].x) * 30.0 * 0.1, resampled[i].z, 1e-3);
+    }
+}
+
+TEST(Track3Test, ProjectSeparatesLevels) {
+    th::Track3d track = make_figure_eight(50.0, 5.0, 400);
+    const double length = th::track_length(track.begin(), track.end());
+
+    // Same xy at the crossing: the height decides which level is found
+    th::TrackPoint3d high = track.project(th::Point3d(0.2, 0.1, 4.5));
+    th::TrackPoint3d low = track.project(th::Point3d(0.2, 0.1, -4.5));
+    EXPECT_NEAR(th::s_diff(high.s, 0.0, length), 0.0, 1.0);
+    EXPECT_NEAR(low.s, 0.5 * length, 1.0);
+    EXPECT_NEAR(high.z, 5.0, 1e-2);
+    EXPECT_NEAR(low.z, -5.0, 1e-2);
+
+    // Warm-started search from the low level stays consistent with the full search
+    size_t hint = track.size() / 2;
+    th::TrackPoint3d warm = track.project(th::Point3d(0.2, 0.1, -4.5), hint, 5);
+    EXPECT_DOUBLE_EQ(warm.s, low.s);
+    EXPECT_DOUBLE_EQ(warm.z, low.z);
+}
+
+TEST(Track3Test, ProjectOnSegmentInterior) {
+    th::Track3d track(std::vector<th::Point3d>{{0.0, 0.0, 0.0}, {10.0, 0.0, 10.0}});
+    track.calculate(false);
+    th::TrackPoint3d p = track.project(th::Point3d(10.0, 1.0, 0.0), false);
+
+    // Closest point of the 3D segment, halfway along it
+    EXPECT_NEAR(p.x, 5.0, 1e-12);
+    EXPECT_NEAR(p.z, 5.0, 1e-12);
+    EXPECT_NEAR(p.s, 0.5 * std::sqrt(200.0), 1e-12);
+    EXPECT_NEAR(p.slope, M_PI / 4.0, 1e-12);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track_batch.hpp>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+th::Track2d make_arc(double radius, size_t n, double sweep) {
+    std::vector<th::TrackPoint2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = sweep * static_cast<double>(i) / static_cast<double>(n - 1);
+        points.emplace_back(radius * std::cos(phi), radius * std::sin(phi));
+    }
+    return th::Track2d(points);
+}
+
+th::TrackBatch2d make_batch(std::vector<th::Track2d>& tracks) {
+    th::TrackBatch2d batch;
+    for (size_t k = 0; k < 50; ++k) {
+        tracks.push_back(make_arc(5.0 + static_cast<double>(k), 10 + k % 7, 1.0 + 0.01 * static_cast<double>(k)));
+        batch.add_track(tracks.back());
+    }
+    return batch;
+}
+
+}  // namespace
+
+TEST(TrackBatchTest, Layout) {
+    std::vector<th::Track2d> tracks;
+    th::TrackBatch2d batch = make_batch(tracks);
+
+    ASSERT_EQ(batch.size(), tracks.size());
+    size_t offset = 0;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        EXPECT_EQ(batch.offset(i), offset);
+        EXPECT_EQ(batch.track_size(i), tracks[i].size());
+        EXPECT_EQ(batch.end(i) - batch.begin(i), static_cast<std::ptrdiff_t>(tracks[i].size()));
+        offset += tracks[i].size();
+    }
+    EXPECT_EQ(batch.num_points(), offset);
+    EXPECT_EQ(batch.track(3).size(), tracks[3].size());
+
+    size_t idx = batch.add_track(4);
+    EXPECT_EQ(batch.track_size(idx), 4);
+    batch.clear();
+    EXPECT_TRUE(batch.empty());
+    EXPECT_EQ(batch.num_points(), 0);
+}
+
+TEST(TrackBatchTest, CalculateMatchesTrack) {
+    std::vector<th::Track2d> tracks;
+    th::TrackBatch2d batch = make_batch(tracks);
+    batch.calculate(false);
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        tracks[i].calculate(false);
+        for (size_t j = 0; j < tracks[i].size(); ++j) {
+            const auto& p = batch.begin(i)[j];
+            EXPECT_EQ(p.s, tracks[i][j].s);
+            EXPECT_EQ(p.psi, tracks[i][j].psi);
+            EXPECT_EQ(p.kappa, tracks[i][j].kappa);
+        }
+    }
+}
+
+TEST(TrackBatchTest, InterpolateMatchesTrack) {
+    std::vector<th::Track2d> tracks;
+    th::TrackBatch2d batch = make_batch(tracks);
+    batch.calculate(false);
+
+    std::vector<double> s = {0.0, 0.5, 1.25, 3.0};
+    std::vector<th::TrackPoint2d> out(s.size() * batch.size());
+    auto end = batch.interpolate(s.begin(), s.end(), out.begin(), false);
+    EXPECT_EQ(end, out.end());
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        tracks[i].calculate(false);
+        for (size_t k = 0; k < s.size(); ++k) {
+            th::TrackPoint2d expected = tracks[i].interpolate(s[k], false);
+            EXPECT_EQ(out[i * s.size() + k].x, expected.x);
+            EXPECT_EQ(out[i * s.size() + k].y, expected.y);
+        }
+    }
+}
+
+TEST(TrackBatchTest, InterpolateTrackMatchesTrack) {
+    std::vector<th::Track2d> tracks;
+    th::TrackBatch2d batch = make_batch(tracks);
+    batch.calculate(false);
+
+    th::TrackBatch2d resampled;
+    batch.interpolate_track(0.3, resampled, false);
+    ASSERT_EQ(resampled.size(), batch.size());
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        tracks[i].calculate(false);
+        th::Track2d expected = tracks[i].interpolate_track(0.3, false);
+        ASSERT_EQ(resampled.track_size(i), expected.size());
+        for (size_t j = 0; j < expected.size(); ++j) {
+            const auto& p = resampled.begin(i)[j];
+            EXPECT_EQ(p.x, expected[j].x);
+            EXPECT_EQ(p.s, expected[j].s);
+            EXPECT_EQ(p.psi, expected[j].psi);
+        }
+    }
+}
+
+TEST(TrackBatchTest, ErrorsPropagate) {
+    th::TrackBatch2d batch;
+    std::vector<th::TrackPoint2d> single = {th::TrackPoint2d(0.0, 0.0)};
+    batch.add_track(make_arc(1.0, 5, 1.0));
+    batch.add_track(single.begin(), single.end());
+    EXPECT_THROW(batch.calculate(false), std::runtime_error);
+
+    th::TrackBatch2d valid;
+    valid.add_track(make_arc(1.0, 5, 1.0));
+    valid.calculate(false);
+    std::vector<double> s = {100.0};
+    std::vector<th::TrackPoint2d> out(1);
+    EXPECT_THROW(valid.interpolate(s.begin(), s.end(), out.begin(), false), std::runtime_error);
+
+    // A failed resampling leaves the output batch untouched
+    th::TrackBatch2d resampled = valid.interpolate_track(0.1, false);
+    const auto points = resampled.points();
+    const auto offsets = resampled.offsets();
+    th::TrackBatch2d invalid = valid;
+    invalid.add_track(make_arc(1.0, 5, 1.0));
+    EXPECT_THROW(invalid.interpolate_track(0.1, resampled, false), std::runtime_error);
+    EXPECT_EQ(resampled.offsets(), offsets);
+    EXPECT_EQ(resampled.points().size(), points.size());
+    EXPECT_EQ(resampled.points().back().s, points.back().s);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track_builder.hpp>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+// Closed curve sampled uniformly in angle; the spacing varies a little with the radius
+std::vector<th::Point2d> make_points(size_t n) {
+    std::vector<th::Point2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        double r = 20.0 + std::sin(3.0 * phi);
+        points.emplace_back(r * std::cos(phi), r * std::sin(phi));
+    }
+    return points;
+}
+
+// Track2::calculate with stepsizes that round to the given index steps
+th::Track2d calculated(const std::vector<th::Point2d>& points, bool is_closed, double pp, double pr, double cp, double cr) {
+    th::Track2d track(points);
+    track.calculate(false);
+    double avg = is_closed ? th::track_length(track.begin(), track.end(), true) / points.size()
+                           : track.back().s / (points.size() - 1);
+    track.calculate(is_closed, pp * avg, pr * avg, cp * avg, cr * avg);
+    return track;
+}
+
+void expect_same(const th::TrackPoint2d& a, const th::TrackPoint2d& b) {
+    EXPECT_EQ(a.s, b.s);
+    EXPECT_EQ(a.psi, b.psi);
+    EXPECT_EQ(a.kappa, b.kappa);
+}
+
+}  // namespace
+
+TEST(TrackBuilderTest, IncrementalMatchesOpenCalculate) {
+    std::vector<th::Point2d> points = make_points(200);
+    th::TrackBuilder2d builder(2, 3, 1, 2);
+    th::Track2d expected = calculated(points, false, 2, 3, 1, 2);
+
+    for (size_t n = 1; n <= points.size(); ++n) {
+        builder.append(points[n - 1]);
+        EXPECT_EQ(builder.num_finalized(), n > 3 ? n - 3 : 0);
+    }
+    // Finalized points never change once more points arrive
+    for (size_t i = 0; i < builder.num_finalized(); ++i) {
+        expect_same(builder.track()[i], expected[i]);
+    }
+    th::Track2d snapshot = builder.snapshot();
+    ASSERT_EQ(snapshot.size(), expected.size());
+    for (size_t i = 0; i < snapshot.size(); ++i) {
+        expect_same(snapshot[i], expected[i]);
+    }
+}
+
+TEST(TrackBuilderTest, LoopClosureMatchesClosedCalculate) {
+    std::vector<th::Point2d> points = make_points(200);
+    th::TrackBuilder2d builder(2, 3, 1, 2);
+    for (const auto& point : points) builder.append(point);
+    builder.close_loop();
+
+    th::Track2d expected = calculated(points, true, 2, 3, 1, 2);
+    EXPECT_TRUE(builder.is_closed());
+    EXPECT_EQ(builder.num_finalized(), points.size());
+    for (size_t i = 0; i < points.size(); ++i) {
+        expect_same(builder.track()[i], expected[i]);
+    }
+    EXPECT_THROW(builder.append(points.front()), std::runtime_error);
+}
+
+TEST(TrackBuilderTest, DefaultStepsMatchCalculate) {
+    std::vector<th::Point2d> points = make_points(50);
+    th::TrackBuilder2d builder;
+    for (const auto& point : points) builder.append(point);
+
+    th::Track2d open = calculated(points, false, 1, 1, 1, 1);
+    th::Track2d snapshot = builder.snapshot();
+    for (size_t i = 0; i < points.size(); ++i) expect_same(snapshot[i], open[i]);
+
+    builder.close_loop();
+    th::Track2d closed = calculated(points, true, 1, 1, 1, 1);
+    for (size_t i = 0; i < points.size(); ++i) expect_same(builder.track()[i], closed[i]);
+}
+
+TEST(TrackBuilderTest, GridFollowsAppends) {
+    std::vector<th::Point2d> points = make_points(300);
+    th::TrackBuilder2d builder(1, 1, 1, 1, 2.0);
+    th::Track2d reference(points);
+    for (size_t n = 0; n < points.size(); ++n) {
+        builder.append(points[n]);
+        if (n % 37 == 36) {
+            th::Track2d prefix(std::vector<th::Point2d>(points.begin(), points.begin() + n + 1));
+            for (const auto& query : {th::Point2d(0.0, 0.0), th::Point2d(25.0, -3.0), th::Point2d(1e5, -4e4), points[n / 2]}) {
+                EXPECT_EQ(builder.find_nearest_idx(query), th::find_nearest_idx(prefix.begin(), prefix.end(), query));
+            }
+        }
+    }
+}
+
+TEST(TrackBuilderTest, TooFewPointsToClose) {
+    th::TrackBuilder2d builder;
+    builder.append(th::Point2d(0.0, 0.0));
+    EXPECT_THROW(builder.close_loop(), std::runtime_error);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track_bundle.hpp>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace {
+
+th::Track2d make_circle(double radius, size_t n, double phase = 0.0) {
+    std::vector<th::TrackPoint2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = phase + 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        points.emplace_back(radius * std::cos(phi), radius * std::sin(phi));
+    }
+    th::Track2d track(points);
+    track.calculate(true);
+    return track;
+}
+
+}  // namespace
+
+TEST(TrackBundleTest, AlignedLinesHaveConstantOffsets) {
+    th::TrackBundle2d bundle(make_circle(10.0, 100));
+    size_t inner = bundle.add_line(make_circle(8.0, 73, 0.3));
+    size_t outer = bundle.add_line(make_circle(12.0, 150));
+
+    ASSERT_EQ(bundle.num_lines(), 2);
+    ASSERT_EQ(bundle.aligned_line(inner).size(), bundle.reference().size());
+    for (size_t i = 0; i < bundle.reference().size(); ++i) {
+        // Counter-clockwise circle: the inner line is on the left
+        EXPECT_NEAR(bundle.line_offset(inner, i), 2.0, 0.05);
+        EXPECT_NEAR(bundle.line_offset(outer, i), -2.0, 0.05);
+    }
+}
+
+TEST(TrackBundleTest, ProjectReturnsAllLines) {
+    th::TrackBundle2d bundle(make_circle(10.0, 100));
+    bundle.add_line(make_circle(8.0, 73, 0.3));
+    bundle.add_line(make_circle(12.0, 150));
+
+    const double phi = 1.0;
+    th::Point2d query(9.0 * std::cos(phi), 9.0 * std::sin(phi));
+    th::BundleProjection2<double> projection = bundle.project(query);
+
+    EXPECT_NEAR(projection.offset, 1.0, 0.05);
+    EXPECT_NEAR(std::atan2(projection.reference.y, projection.reference.x), phi, 0.01);
+    ASSERT_EQ(projection.lines.size(), 2);
+    EXPECT_NEAR(std::atan2(projection.lines[0].y, projection.lines[0].x), phi, 0.01);
+    EXPECT_NEAR(std::atan2(projection.lines[1].y, projection.lines[1].x), phi, 0.01);
+    EXPECT_NEAR(projection.lines[1].s, 12.0 * phi, 0.1);
+    EXPECT_NEAR(projection.line_offsets[0], 2.0, 0.05);
+    EXPECT_NEAR(projection.line_offsets[1], -2.0, 0.05);
+}
+
+TEST(TrackBundleTest, LineStationWrapsAtSeam) {
+    // The inner line starts half a lap later, so its s wraps inside the reference lap
+    th::TrackBundle2d bundle(make_circle(10.0, 100));
+    bundle.add_line(make_circle(8.0, 80, M_PI));
+
+    for (double phi = 0.05; phi < 2.0 * M_PI; phi += 0.1) {
+        th::Point2d query(10.0 * std::cos(phi), 10.0 * std::sin(phi));
+        th::BundleProjection2<double> projection = bundle.project(query);
+        double expected = 8.0 * std::fmod(phi + M_PI, 2.0 * M_PI);
+        double line_length = 8.0 * 80.0 * 2.0 * std::sin(M_PI / 80.0);
+        double s = projection.lines[0].s;
+        EXPECT_GE(s, 0.0);
+        EXPECT_LT(s, line_length);
+        EXPECT_NEAR(s, expected, 0.1);
+    }
+}
+
+TEST(TrackBundleTest, WarmStartMatchesFullSearch) {
+    th::TrackBundle2d bundle(make_circle(10.0, 200));
+    bundle.add_line(make_circle(12.0, 150));
+
+    th::BundleProjection2<double> full;
+    th::BundleProjection2<double> warm;
+    size_t hint = 0;
+    for (double phi = 0.0; phi < 2.0 * M_PI; phi += 0.05) {
+        th::Point2d query(10.5 * std::cos(phi), 10.5 * std::sin(phi));
+        bundle.project(query, full);
+        bundle.project(query, hint, 4, warm);
+        EXPECT_NEAR(warm.lines[0].x, full.lines[0].x, 1e-12);
+        EXPECT_NEAR(warm.lines[0].y, full.lines[0].y, 1e-12);
+        hint = warm.segment;
+    }
+}
+
+TEST(TrackBundleTest, DenseLineIsAligned) {
+    // 100 line segments per reference step, far more than the alignment window
+    th::TrackBundle2d bundle(make_circle(10.0, 40), true, 16);
+    size_t line = bundle.add_line(make_circle(12.0, 4000, 0.5));
+
+    const auto& aligned = bundle.aligned_line(line);
+    for (size_t i = 0; i < bundle.reference().size(); ++i) {
+        const auto& r = bundle.reference()[i];
+        EXPECT_NEAR(bundle.line_offset(line, i), -2.0, 0.05) << i;
+        EXPECT_NEAR(th::angle_diff(std::atan2(aligned[i].y, aligned[i].x), std::atan2(r.y, r.x)), 0.0, 1e-3) << i;
+    }
+}
+
+TEST(TrackBundleTest, ProjectMatchesFullSearch) {
+    th::TrackBundle2d bundle(make_circle(10.0, 100));
+    bundle.add_line(make_circle(12.0, 150));
+    const auto& reference = bundle.reference();
+
+    for (double x = -14.0; x <= 14.0; x += 0.7) {
+        for (double y = -14.0; y <= 14.0; y += 0.9) {
+            th::Point2d query(x, y);
+            auto expected = th::find_segment_projection(reference.begin(), reference.end(), query, 0, reference.size(), true);
+            auto projection = bundle.project(query);
+            EXPECT_EQ(projection.segment, expected.segment);
+            EXPECT_EQ(projection.reference.x, expected.point.x);
+            EXPECT_EQ(projection.reference.y, expected.point.y);
+        }
+    }
+}
+
+TEST(TrackBundleTest, CopiesAndPmrAllocators) {
+    std::array<std::byte, 1 << 16> buffer;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+    th::pmr::Track2d reference(make_circle(10.0, 100), &arena);
+
+    th::TrackBundle2<double, std::pmr::polymorphic_allocator<th::TrackPoint2d>> bundle(std::move(reference));
+    bundle.add_line(make_circle(8.0, 73, 0.3));
+    EXPECT_EQ(bundle.aligned_line(0).get_allocator().resource(), &arena);
+
+    auto copy = bundle;
+    th::Point2d query(9.0, 1.0);
+    auto expected = bundle.project(query);
+    auto projection = copy.project(query);
+    EXPECT_EQ(projection.segment, expected.segment);
+    EXPECT_EQ(projection.lines[0].x, expected.lines[0].x);
+    EXPECT_EQ(projection.lines[0].y, expected.lines[0].y);
+}
+
+TEST(TrackBundleTest, TooFewPointsThrow) {
+    std::vector<th::TrackPoint2d> points = {th::TrackPoint2d(0.0, 0.0)};
+    EXPECT_THROW(th::TrackBundle2d bundle{th::Track2d(points)}, std::runtime_error);
+
+    th::TrackBundle2d bundle(make_circle(10.0, 20));
+    EXPECT_THROW(bundle.add_line(th::Track2d(points)), std::runtime_error);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
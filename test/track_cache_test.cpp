@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track_cache.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+th::Track2d make_circle(double radius, size_t n) {
+    std::vector<th::Point2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        points.emplace_back(radius * std::cos(phi), radius * std::sin(phi));
+    }
+    return th::Track2d(points);
+}
+
+class TrackCacheTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        path_ = ::testing::TempDir() + "th_track_cache_" +
+            ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin";
+        std::remove(path_.c_str());
+    }
+    void TearDown() override { std::remove(path_.c_str()); }
+
+    std::string path_;
+};
+
+void expect_equal(const th::Track2d& a, const th::Track2d& b) {
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        EXPECT_EQ(a[i].s, b[i].s);
+        EXPECT_EQ(a[i].x, b[i].x);
+        EXPECT_EQ(a[i].y, b[i].y);
+        EXPECT_EQ(a[i].psi, b[i].psi);
+        EXPECT_EQ(a[i].kappa, b[i].kappa);
+    }
+}
+
+}  // namespace
+
+TEST_F(TrackCacheTest, Fnv1aReferenceValues) {
+    EXPECT_EQ(th::cache::fnv1a("", 0), 0xcbf29ce484222325ull);
+    EXPECT_EQ(th::cache::fnv1a("a", 1), 0xaf63dc4c8601ec8cull);
+    EXPECT_EQ(th::cache::fnv1a("foobar", 6), 0x85944171f73967e8ull);
+}
+
+TEST_F(TrackCacheTest, CalculateMissThenHit) {
+    th::Track2d expected = make_circle(10.0, 300);
+    expected.calculate(true, 2.0, 2.0, 3.0, 3.0);
+
+    th::Track2d first = make_circle(10.0, 300);
+    EXPECT_FALSE(th::calculate_cached(first, path_, true, 2.0, 2.0, 3.0, 3.0));
+    expect_equal(first, expected);
+
+    th::Track2d second = make_circle(10.0, 300);
+    EXPECT_TRUE(th::calculate_cached(second, path_, true, 2.0, 2.0, 3.0, 3.0));
+    expect_equal(second, expected);
+}
+
+TEST_F(TrackCacheTest, HitMustMatchGeometry) {
+    // An entry of another track under this track's key, as after a key collision
+    th::Track2d track = make_circle(10.0, 300);
+    const auto key = th::cache::calculate_key(track, true, 1.0, 1.0, 1.0, 1.0, true);
+    th::Track2d other = make_circle(12.0, 300);
+    other.calculate(true);
+    th::cache::save(path_, key, other);
+
+    th::Track2d expected = make_circle(10.0, 300);
+    expected.calculate(true);
+    EXPECT_FALSE(th::calculate_cached(track, path_, true, 1.0, 1.0, 1.0, 1.0, true));
+    expect_equal(track, expected);
+
+    // Widths are part of the geometry
+    th::Track2d widened = make_circle(10.0, 300);
+    widened[7].wl = 2.0;
+    th::cache::save(path_, key, widened);
+    th::Track2d narrow = make_circle(10.0, 300);
+    EXPECT_FALSE(th::calculate_cached(narrow, path_, true, 1.0, 1.0, 1.0, 1.0, true));
+    EXPECT_TRUE(th::calculate_cached(narrow, path_, true, 1.0, 1.0, 1.0, 1.0, true));
+}
+
+TEST_F(TrackCacheTest, KeyCoversInputsAndParameters) {
+    th::Track2d track = make_circle(10.0, 300);
+    th::Track2d moved = make_circle(10.0, 300);
+    moved[17].x += 1e-9;
+
+    const auto key = th::cache::calculate_key(track, true, 1.0, 1.0, 1.0, 1.0, true);
+    EXPECT_EQ(key, th::cache::calculate_key(make_circle(10.0, 300), true, 1.0, 1.0, 1.0, 1.0, true));
+    EXPECT_NE(key, th::cache::calculate_key(moved, true, 1.0, 1.0, 1.0, 1.0, true));
+    EXPECT_NE(key, th::cache::calculate_key(track, false, 1.0, 1.0, 1.0, 1.0, true));
+    EXPECT_NE(key, th::cache::calculate_key(track, true, 1.0, 1.0, 2.0, 1.0, true));
+    EXPECT_NE(key, th::cache::calculate_key(track, true, 1.0, 1.0, 1.0, 1.0, false));
+
+    // Derived columns do not change the key
+    th::Track2d calculated = make_circle(10.0, 300);
+    calculated.calculate(true);
+    EXPECT_EQ(key, th::cache::calculate_key(calculated, true, 1.0, 1.0, 1.0, 1.0, true));
+
+    // A stale file is a miss and gets replaced
+    EXPECT_FALSE(th::calculate_cached(track, path_));
+    EXPECT_FALSE(th::calculate_cached(moved, path_));
+    th::Track2d again = make_circle(10.0, 300);
+    again[17].x += 1e-9;
+    EXPECT_TRUE(th::calculate_cached(again, path_));
+}
+
+TEST_F(TrackCacheTest, InterpolateTrackMissThenHit) {
+    th::Track2d track = make_circle(10.0, 100);
+    track.calculate(true);
+    th::Track2d expected = track.interpolate_track(0.25, true);
+
+    th::Track2d out;
+    EXPECT_FALSE(th::interpolate_track_cached(track, 0.25, out, path_, true));
+    expect_equal(out, expected);
+    th::Track2d cached;
+    EXPECT_TRUE(th::interpolate_track_cached(track, 0.25, cached, path_, true));
+    expect_equal(cached, expected);
+    EXPECT_FALSE(th::interpolate_track_cached(track, 0.5, cached, path_, true));
+}
+
+TEST_F(TrackCacheTest, CorruptFilesAreMisses) {
+    th::Track2d track = make_circle(10.0, 50);
+    const auto key = th::cache::calculate_key(track, true, 1.0, 1.0, 1.0, 1.0, true);
+    track.calculate(true);
+    th::cache::save(path_, key, track);
+
+    th::Track2d loaded;
+    EXPECT_TRUE(th::cache::load(path_, key, loaded));
+    EXPECT_FALSE(th::cache::load(path_, key + 1, loaded));
+    EXPECT_FALSE(th::cache::load(path_ + ".missing", key, loaded));
+
+    // Truncated payload
+    {
+        std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+        th::cache::Header header = {{'T', 'H', 'T', 'C'}, th::cache::kVersion, sizeof(double),
+            sizeof(th::TrackPoint2d), key, 50};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+    EXPECT_FALSE(th::cache::load(path_, key, loaded));
+    EXPECT_TRUE(loaded.empty());
+
+    // Point count far beyond the file length must not be allocated
+    {
+        std::ofstream file(path_, std::ios::binary | std::ios::trunc);
+        th::cache::Header header = {{'T', 'H', 'T', 'C'}, th::cache::kVersion, sizeof(double),
+            sizeof(th::TrackPoint2d), key, std::uint64_t(1) << 60};
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(track.data()), static_cast<std::streamsize>(track.size() * sizeof(th::TrackPoint2d)));
+    }
+    EXPECT_FALSE(th::cache::load(path_, key, loaded));
+    EXPECT_TRUE(loaded.empty());
+
+    // Trailing bytes after the payload
+    th::cache::save(path_, key, track);
+    {
+        std::ofstream file(path_, std::ios::binary | std::ios::app);
+        file.put('x');
+    }
+    EXPECT_FALSE(th::cache::load(path_, key, loaded));
+
+    // float and double entries do not mix
+    th::Track2f track_f;
+    EXPECT_FALSE(th::cache::load(path_, key, track_f));
+}
+
+TEST_F(TrackCacheTest, UnwritableFilesAreNotCached) {
+    const std::string path = ::testing::TempDir() + "th_track_cache_missing_dir/cache.bin";
+    th::Track2d track = make_circle(10.0, 50);
+    const auto key = th::cache::calculate_key(track, true, 1.0, 1.0, 1.0, 1.0, true);
+
+    EXPECT_FALSE(th::cache::try_save(path, key, track));
+    EXPECT_THROW(th::cache::save(path, key, track), std::runtime_error);
+
+    EXPECT_FALSE(th::calculate_cached(track, path, true));
+    EXPECT_TRUE(track.has_kappa());
+    th::Track2d resampled;
+    EXPECT_FALSE(th::interpolate_track_cached(track, 0.5, resampled, path, true));
+    EXPECT_FALSE(resampled.empty());
+}
+
+TEST_F(TrackCacheTest, SaveReplacesExistingFile) {
+    th::Track2d track = make_circle(10.0, 50);
+    track.calculate(true);
+    th::cache::save(path_, 1, track);
+    th::Track2d other = make_circle(5.0, 20);
+    other.calculate(true);
+    th::cache::save(path_, 2, other);
+
+    th::Track2d loaded;
+    EXPECT_FALSE(th::cache::load(path_, 1, loaded));
+    EXPECT_TRUE(th::cache::load(path_, 2, loaded));
+    expect_equal(loaded, other);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -59,6 +59,58 @@ TEST(Track2CalculateTest, CalculateTrackUnclosed) {
     EXPECT_NEAR(track[3].kappa, track[0].kappa, 1e-10);
 }
 
+TEST(Track2CalculateTest, CalculateCircleWithSteps) {
+    const double radius = 20.0;
+    std::vector<th::Point2d> points;
+    for (int i = 0; i < 200; ++i) {
+        double phi = 2 * M_PI * i / 200;
+        points.emplace_back(radius * std::cos(phi), radius * std::sin(phi));
+    }
+    th::Track2d track(points);
+    track.calculate(true, 2.0, 2.0, 3.0, 3.0);
+
+    // Points next to the seam use wrapped indices, the others do not
+    for (size_t i = 0; i < track.size(); ++i) {
+        double phi = 2 * M_PI * i / 200;
+        EXPECT_NEAR(th::angle_diff(track[i].psi, th::normalize_psi(phi + M_PI / 2)), 0.0, 1e-9);
+        EXPECT_NEAR(track[i].kappa, 1.0 / radius, 1e-4);
+    }
+}
+
+TEST(Track2CalculateTest, CalculateOpenArcWithSteps) {
+    // Dense open arc (about 0.05 between points) with small irregular radial noise
+    const double radius = 10.0;
+    std::vector<th::Point2d> points;
+    for (int i = 0; i < 400; ++i) {
+        double phi = 2.0 * i / 400;
+        double r = radius + 1e-3 * std::sin(0.7 * i * i);
+        points.emplace_back(r * std::cos(phi), r * std::sin(phi));
+    }
+    th::Track2d windowed(points);
+    windowed.calculate(false, 1.0, 1.0, 1.0, 1.0);
+    th::Track2d neighbours(points);
+    neighbours.calculate(false, 0.0, 0.0, 0.0, 0.0);
+
+    double max_err_windowed = 0.0;
+    double max_err_neighbours = 0.0;
+    for (size_t i = 40; i + 40 < points.size(); ++i) {
+        double phi = 2.0 * i / 400;
+        EXPECT_NEAR(th::angle_diff(windowed[i].psi, th::normalize_psi(phi + M_PI / 2)), 0.0, 1e-3);
+        max_err_windowed = std::max(max_err_windowed, std::abs(windowed[i].kappa - 1.0 / radius));
+        max_err_neighbours = std::max(max_err_neighbours, std::abs(neighbours[i].kappa - 1.0 / radius));
+    }
+    EXPECT_LT(max_err_windowed, 2e-3);
+    EXPECT_LT(max_err_windowed, 0.1 * max_err_neighbours);
+
+    // Windows are clamped at the ends
+    for (size_t i = 0; i < windowed.size(); ++i) {
+        EXPECT_TRUE(std::isfinite(windowed[i].psi));
+        EXPECT_TRUE(std::isfinite(windowed[i].kappa));
+    }
+    EXPECT_GT(windowed.front().kappa, 0.0);
+    EXPECT_GT(windowed.back().kappa, 0.0);
+}
+
 int main(int argc, char **argv) {
     testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
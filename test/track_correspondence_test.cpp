@@ -0,0 +1,117 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track_correspondence.hpp>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+th::Track2d make_circle(double radius, size_t n, double phase = 0.0) {
+    std::vector<th::TrackPoint2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = phase + 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        points.emplace_back(radius * std::cos(phi), radius * std::sin(phi));
+    }
+    th::Track2d track(points);
+    track.calculate(true);
+    return track;
+}
+
+}  // namespace
+
+TEST(TrackCorrespondenceTest, ConcentricCirclesScaleS) {
+    th::Track2d source = make_circle(10.0, 200);
+    th::Track2d target = make_circle(12.0, 150);
+    th::TrackCorrespondence2d correspondence(source, target);
+
+    ASSERT_EQ(correspondence.size(), source.size() + 1);
+    for (double s = 0.0; s < 60.0; s += 1.7) {
+        EXPECT_NEAR(correspondence.map(s), 1.2 * s, 0.05);
+    }
+}
+
+TEST(TrackCorrespondenceTest, DenseTargetIsFollowed) {
+    // 100 target segments per source step, far more than the search window
+    th::Track2d source = make_circle(10.0, 40);
+    th::Track2d target = make_circle(12.0, 4000);
+    th::TrackCorrespondence2d correspondence(source, target, true, 16);
+
+    for (double s = 0.0; s < 60.0; s += 1.7) {
+        EXPECT_NEAR(correspondence.map(s), 1.2 * s, 0.5);
+    }
+}
+
+TEST(TrackCorrespondenceTest, TargetSeamIsUnwrapped) {
+    th::Track2d source = make_circle(10.0, 200);
+    th::Track2d target = make_circle(12.0, 150, M_PI);
+    th::TrackCorrespondence2d correspondence(source, target);
+    const double target_length = th::track_length(target.begin(), target.end(), true);
+
+    const auto& target_s = correspondence.target_s();
+    for (size_t i = 1; i < target_s.size(); ++i) {
+        EXPECT_GT(target_s[i], target_s[i - 1]);
+    }
+    for (double s = 0.0; s < 62.0; s += 1.3) {
+        double expected = std::fmod(1.2 * s + 0.5 * target_length, target_length);
+        double mapped = correspondence.map(s);
+        EXPECT_GE(mapped, 0.0);
+        EXPECT_LT(mapped, target_length);
+        EXPECT_NEAR(std::remainder(mapped - expected, target_length), 0.0, 0.05);
+    }
+}
+
+TEST(TrackCorrespondenceTest, ClosedWrapsSourceLaps) {
+    th::Track2d source = make_circle(10.0, 200);
+    th::Track2d target = make_circle(12.0, 150);
+    th::TrackCorrespondence2d correspondence(source, target);
+    const double source_length = th::track_length(source.begin(), source.end(), true);
+
+    EXPECT_NEAR(correspondence.map(10.0 + source_length), correspondence.map(10.0), 1e-9);
+    EXPECT_NEAR(correspondence.map(10.0 - 2.0 * source_length), correspondence.map(10.0), 1e-9);
+}
+
+TEST(TrackCorrespondenceTest, OpenTracksClamp) {
+    std::vector<th::TrackPoint2d> source_points;
+    std::vector<th::TrackPoint2d> target_points;
+    for (int i = 0; i <= 10; ++i) {
+        source_points.emplace_back(static_cast<double>(i), 0.0);
+        target_points.emplace_back(0.5 * static_cast<double>(i) - 1.0, 1.0);
+    }
+    th::Track2d source(source_points);
+    th::Track2d target(target_points);
+    source.calculate(false);
+    target.calculate(false);
+    th::TrackCorrespondence2d correspondence(source, target, false);
+
+    EXPECT_NEAR(correspondence.map(0.0), 1.0, 1e-9);
+    EXPECT_NEAR(correspondence.map(2.5), 3.5, 1e-9);
+    EXPECT_NEAR(correspondence.map(4.0), 5.0, 1e-9);
+    EXPECT_NEAR(correspondence.map(8.0), 5.0, 1e-9);  // Past the target end
+    EXPECT_NEAR(correspondence.map(-1.0), 1.0, 1e-9);
+}
+
+TEST(TrackCorrespondenceTest, BatchMatchesScalar) {
+    th::Track2d source = make_circle(10.0, 200);
+    th::Track2d target = make_circle(12.0, 150, 1.0);
+    th::TrackCorrespondence2d correspondence(source, target);
+
+    std::vector<double> queries;
+    for (double s = -5.0; s < 130.0; s += 0.7) queries.push_back(s);
+    queries.push_back(3.0);  // Non-monotone query falls back to a binary search
+
+    std::vector<double> mapped(queries.size());
+    correspondence.map(queries.begin(), queries.end(), mapped.begin());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        EXPECT_NEAR(mapped[i], correspondence.map(queries[i]), 1e-9);
+    }
+}
+
+TEST(TrackCorrespondenceTest, MissingSThrows) {
+    std::vector<th::TrackPoint2d> points = {th::TrackPoint2d(0.0, 0.0), th::TrackPoint2d(1.0, 0.0)};
+    th::Track2d track(points);
+    EXPECT_THROW(th::TrackCorrespondence2d(track, make_circle(1.0, 10)), std::runtime_error);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
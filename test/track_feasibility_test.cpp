@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track_feasibility.hpp>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+th::Track2d make_line(size_t n, double y, double wl, double wr) {
+    std::vector<th::TrackPoint2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        points.emplace_back(static_cast<double>(i), y, wl, wr);
+    }
+    th::Track2d track(points);
+    track.calculate(false);
+    return track;
+}
+
+th::Track2d make_arc(double radius, size_t n) {
+    std::vector<th::TrackPoint2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 0.01 * static_cast<double>(i);
+        points.emplace_back(radius * std::sin(phi), radius - radius * std::cos(phi));
+    }
+    th::Track2d track(points);
+    track.calculate(false);
+    return track;
+}
+
+}  // namespace
+
+TEST(TrackFeasibilityTest, FeasiblePath) {
+    th::Track2d path = make_arc(50.0, 100);
+    th::FeasibilityLimits<double> limits;
+    limits.kappa_max = 0.1;
+    limits.dkappa_max = 0.1;
+    EXPECT_EQ(th::first_infeasible_idx(path.begin(), path.end(), limits), -1);
+}
+
+TEST(TrackFeasibilityTest, CurvatureLimit) {
+    th::Track2d path = make_arc(50.0, 100);
+    th::FeasibilityLimits<double> limits;
+    limits.kappa_max = 0.1;
+    path[37].kappa = 0.2;
+    path[80].kappa = 0.2;
+    EXPECT_EQ(th::first_infeasible_idx(path.begin(), path.end(), limits), 37);
+
+    limits.kappa_max = 0.01;
+    EXPECT_EQ(th::first_infeasible_idx(path.begin(), path.end(), limits), 0);
+}
+
+TEST(TrackFeasibilityTest, CurvatureRateLimit) {
+    th::Track2d path = make_line(60, 0.0, 2.0, 2.0);
+    th::FeasibilityLimits<double> limits;
+    limits.dkappa_max = 0.05;
+    for (size_t i = 20; i < path.size(); ++i) {
+        path[i].kappa = 0.02 * static_cast<double>(i - 20);  // ramp of 0.02 per meter from index 20
+    }
+    EXPECT_EQ(th::first_infeasible_idx(path.begin(), path.end(), limits), -1);
+    path[45].kappa += 0.1;
+    EXPECT_EQ(th::first_infeasible_idx(path.begin(), path.end(), limits), 45);
+}
+
+TEST(TrackFeasibilityTest, OwnWidths) {
+    th::Track2d path = make_line(40, 0.0, 2.0, 2.0);
+    th::FeasibilityLimits<double> limits;
+    limits.width_margin = 0.5;
+    EXPECT_EQ(th::first_infeasible_idx(path.begin(), path.end(), limits), -1);
+    path[33].wr = 0.3;
+    EXPECT_EQ(th::first_infeasible_idx(path.begin(), path.end(), limits), 33);
+}
+
+TEST(TrackFeasibilityTest, OffsetFromReference) {
+    th::Track2d reference = make_line(100, 0.0, 2.0, 1.0);
+    th::FeasibilityLimits<double> limits;
+    limits.width_margin = 0.25;
+    th::FeasibilityChecker2d checker(reference, limits, false);
+
+    th::Track2d inside = make_line(50, 1.5, 0.5, 3.5);
+    EXPECT_EQ(checker.check(inside.begin(), inside.end()), -1);
+
+    th::Track2d left = make_line(50, 1.8, 0.5, 0.5);
+    EXPECT_EQ(checker.check(left.begin(), left.end()), 0);
+    th::Track2d right = make_line(50, -0.8, 0.5, 0.5);
+    EXPECT_EQ(checker.check(right.begin(), right.end()), 0);
+
+    // Drifts out to the right from index 30
+    std::vector<th::TrackPoint2d> points;
+    for (int i = 0; i < 50; ++i) {
+        points.emplace_back(static_cast<double>(i), i < 30 ? 0.0 : -0.1 * (i - 29));
+    }
+    th::Track2d drift(points);
+    drift.calculate(false);
+    EXPECT_EQ(checker.check(drift.begin(), drift.end()), 37);
+
+    // The earlier of a limit and an offset violation wins
+    drift[10].kappa = 100.0;
+    th::FeasibilityLimits<double> kappa_limits = limits;
+    kappa_limits.kappa_max = 1.0;
+    th::FeasibilityChecker2d kappa_checker(reference, kappa_limits, false);
+    EXPECT_EQ(kappa_checker.check(drift.begin(), drift.end()), 10);
+}
+
+TEST(TrackFeasibilityTest, NaNViolates) {
+    th::Track2d path = make_line(100, 0.0, 2.0, 2.0);
+    th::FeasibilityLimits<double> limits;
+    EXPECT_EQ(th::first_infeasible_idx(path.begin(), path.end(), limits), -1);  // Unchecked limits
+    path[70].wl = std::nan("");
+    EXPECT_EQ(th::first_infeasible_idx(path.begin(), path.end(), limits), 70);
+    path[42].kappa = std::nan("");
+    EXPECT_EQ(th::first_infeasible_idx(path.begin(), path.end(), limits), 42);
+    path[0].kappa = std::nan("");
+    EXPECT_EQ(th::first_infeasible_idx(path.begin(), path.end(), limits), 0);
+
+    th::Track2d reference = make_line(100, 0.0, 2.0, 2.0);
+    th::FeasibilityChecker2d checker(reference, limits, false);
+    th::Track2d offset = make_line(50, 0.5, 0.5, 0.5);
+    EXPECT_EQ(checker.check(offset.begin(), offset.end()), -1);
+    offset[25].y = std::nan("");
+    EXPECT_EQ(checker.check(offset.begin(), offset.end()), 25);
+}
+
+TEST(TrackFeasibilityTest, BatchMatchesSingle) {
+    th::Track2d reference = make_line(100, 0.0, 2.0, 2.0);
+    th::FeasibilityLimits<double> limits;
+    limits.kappa_max = 0.05;
+    th::FeasibilityChecker2d checker(reference, limits, false);
+
+    th::TrackBatch2d batch;
+    for (int k = 0; k < 40; ++k) {
+        th::Track2d path = make_arc(10.0 + 2.0 * k, 60);
+        batch.add_track(path);
+    }
+    std::vector<std::ptrdiff_t> result(batch.size());
+    std::vector<std::ptrdiff_t> limit_result(batch.size());
+    checker.check(batch, result.begin());
+    th::first_infeasible_idx(batch, limits, limit_result.begin());
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        EXPECT_EQ(result[i], checker.check(batch.begin(i), batch.end(i)));
+        EXPECT_EQ(limit_result[i], th::first_infeasible_idx(batch.begin(i), batch.end(i), limits));
+    }
+    EXPECT_EQ(limit_result[0], 0);   // Radius 10 exceeds the curvature limit
+    EXPECT_EQ(limit_result[39], -1);
+}
+
+TEST(TrackFeasibilityTest, Errors) {
+    std::vector<th::TrackPoint2d> points = {th::TrackPoint2d(0.0, 0.0), th::TrackPoint2d(1.0, 0.0)};
+    th::Track2d path(points);
+    th::FeasibilityLimits<double> limits;
+    EXPECT_THROW(th::first_infeasible_idx(path.begin(), path.end(), limits), std::runtime_error);
+    path.calculate(false);
+    EXPECT_THROW(th::FeasibilityChecker2d(path, limits), std::runtime_error);  // No widths
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track_handle.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Square track whose widths carry a tag identifying the publication
+th::Track2d make_tagged_track(double tag) {
+    std::vector<th::TrackPoint2d> points = {
+        th::TrackPoint2d(0.0, 0.0, tag, tag),
+        th::TrackPoint2d(1.0, 0.0, tag, tag),
+        th::TrackPoint2d(1.0, 1.0, tag, tag),
+        th::TrackPoint2d(0.0, 1.0, tag, tag)
+    };
+    th::Track2d track(points);
+    track.calculate(true);
+    return track;
+}
+
+}  // namespace
+
+TEST(TrackHandle2Test, PublishAndLoad) {
+    th::TrackHandle2d handle;
+    EXPECT_EQ(handle.load(), nullptr);
+    EXPECT_EQ(handle.version(), 0);
+
+    handle.publish(make_tagged_track(1.0));
+    auto snapshot = handle.load();
+    ASSERT_NE(snapshot, nullptr);
+    EXPECT_EQ(snapshot->front().wl, 1.0);
+    EXPECT_EQ(handle.version(), 1);
+
+    // Old snapshots stay valid after a new publication
+    handle.publish(make_tagged_track(2.0));
+    EXPECT_EQ(snapshot->front().wl, 1.0);
+    EXPECT_EQ(handle.load()->front().wl, 2.0);
+    EXPECT_EQ(handle.version(), 2);
+}
+
+TEST(TrackHandle2Test, ConcurrentReadersSeeConsistentSnapshots) {
+    th::TrackHandle2d handle(make_tagged_track(0.0));
+    std::atomic<bool> done{false};
+    std::atomic<int> inconsistent{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 4; ++r) {
+        readers.emplace_back([&]() {
+            double last_tag = 0.0;
+            while (!done.load()) {
+                auto snapshot = handle.load();
+                double tag = snapshot->front().wl;
+                for (const auto& p : *snapshot) {
+                    if (p.wl != tag || p.wr != tag) ++inconsistent;
+                }
+                if (tag < last_tag) ++inconsistent;  // publications are never lost or reordered
+                last_tag = tag;
+                snapshot->project(th::Point2d(0.5, -1.0), true);
+            }
+        });
+    }
+
+    for (int i = 1; i <= 500; ++i) {
+        handle.publish(make_tagged_track(i));
+    }
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(inconsistent.load(), 0);
+    EXPECT_EQ(handle.load()->front().wl, 500.0);
+}
+
+TEST(TrackHandle2Test, ConcurrentWritersAreSerialized) {
+    th::TrackHandle2d handle(make_tagged_track(0.0));
+    std::atomic<bool> done{false};
+    std::atomic<int> inconsistent{0};
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; ++r) {
+        readers.emplace_back([&]() {
+            while (!done.load()) {
+                auto snapshot = handle.load();
+                if (snapshot == nullptr || snapshot->front().wl != snapshot->back().wr) ++inconsistent;
+            }
+        });
+    }
+    std::vector<std::thread> writers;
+    for (int w = 1; w <= 3; ++w) {
+        writers.emplace_back([&, w]() {
+            for (int i = 0; i < 200; ++i) {
+                handle.publish(make_tagged_track(w));
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(inconsistent.load(), 0);
+    EXPECT_EQ(handle.version(), 601);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track_interpolator.hpp>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+th::Track2d make_circle(double radius, size_t n) {
+    std::vector<th::Point2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        points.emplace_back(radius * std::cos(phi), radius * std::sin(phi));
+    }
+    th::Track2d track(points);
+    track.calculate(true);
+    return track;
+}
+
+// Heading close to ±π: drives in -x direction with a slight wobble in y
+th::Track2d make_westward() {
+    std::vector<th::Point2d> points;
+    for (int i = 0; i < 20; ++i) {
+        points.emplace_back(-static_cast<double>(i), i % 2 == 0 ? 0.0 : 0.01);
+    }
+    th::Track2d track(points);
+    track.calculate(false);
+    return track;
+}
+
+}  // namespace
+
+TEST(TrackInterpolatorTest, LinearPsiIsWrapCorrect) {
+    th::Track2d track = make_westward();
+    th::TrackInterpolator2d interpolator(track, false, th::InterpolationMode::Linear);
+    for (double s = 0.0; s < track.back().s; s += 0.1) {
+        EXPECT_GT(std::abs(track.interpolate(s, false).psi), 3.0);
+        EXPECT_GT(std::abs(interpolator.interpolate(s).psi), 3.0);
+    }
+}
+
+TEST(TrackInterpolatorTest, LinearMatchesTrack) {
+    th::Track2d track = make_circle(10.0, 50);
+    th::TrackInterpolator2d interpolator(track, true, th::InterpolationMode::Linear);
+    for (double s = -5.0; s < 70.0; s += 0.37) {
+        th::TrackPoint2d expected = track.interpolate(s, true);
+        th::TrackPoint2d actual = interpolator.interpolate(s);
+        EXPECT_NEAR(actual.x, expected.x, 1e-9);
+        EXPECT_NEAR(actual.y, expected.y, 1e-9);
+        EXPECT_NEAR(th::angle_diff(actual.psi, expected.psi), 0.0, 1e-9);
+        EXPECT_NEAR(actual.kappa, expected.kappa, 1e-9);
+    }
+}
+
+TEST(TrackInterpolatorTest, HermiteIsCloserToTheCurve) {
+    const double radius = 10.0;
+    th::Track2d track = make_circle(radius, 16);
+    th::TrackInterpolator2d linear(track, true, th::InterpolationMode::Linear);
+    th::TrackInterpolator2d hermite(track, true, th::InterpolationMode::Hermite);
+
+    double max_err_linear = 0.0;
+    double max_err_hermite = 0.0;
+    double max_psi_err_hermite = 0.0;
+    const double length = th::track_length(track.begin(), track.end(), true);
+    for (double s = 0.0; s < length; s += 0.05) {
+        th::TrackPoint2d l = linear.interpolate(s);
+        th::TrackPoint2d h = hermite.interpolate(s);
+        max_err_linear = std::max(max_err_linear, std::abs(std::hypot(l.x, l.y) - radius));
+        max_err_hermite = std::max(max_err_hermite, std::abs(std::hypot(h.x, h.y) - radius));
+        double psi_expected = std::atan2(h.y, h.x) + M_PI / 2;
+        max_psi_err_hermite = std::max(max_psi_err_hermite, std::abs(th::angle_diff(h.psi, psi_expected)));
+    }
+    EXPECT_LT(max_err_hermite, 0.1 * max_err_linear);
+    EXPECT_LT(max_psi_err_hermite, 0.01);
+}
+
+TEST(TrackInterpolatorTest, HermiteHitsTheNodes) {
+    th::Track2d track = make_circle(10.0, 16);
+    th::TrackInterpolator2d interpolator(track);
+    for (const auto& p : track) {
+        th::TrackPoint2d interpolated = interpolator.interpolate(p.s);
+        EXPECT_NEAR(interpolated.x, p.x, 1e-9);
+        EXPECT_NEAR(interpolated.y, p.y, 1e-9);
+        EXPECT_NEAR(th::angle_diff(interpolated.psi, p.psi), 0.0, 1e-9);
+    }
+}
+
+TEST(TrackInterpolatorTest, BatchMatchesScalar) {
+    th::Track2d track = make_circle(10.0, 40);
+    th::TrackInterpolator2d interpolator(track);
+    std::vector<double> s;
+    for (double v = -10.0; v < 140.0; v += 0.9) s.push_back(v);
+    s.push_back(1.0);
+
+    std::vector<th::TrackPoint2d> out(s.size());
+    interpolator.interpolate(s.begin(), s.end(), out.begin());
+    for (size_t i = 0; i < s.size(); ++i) {
+        th::TrackPoint2d expected = interpolator.interpolate(s[i]);
+        EXPECT_EQ(out[i].x, expected.x);
+        EXPECT_EQ(out[i].psi, expected.psi);
+    }
+}
+
+TEST(TrackInterpolatorTest, Errors) {
+    th::Track2d track = make_westward();
+    th::TrackInterpolator2d interpolator(track, false);
+    EXPECT_THROW(interpolator.interpolate(-1.0), std::runtime_error);
+    EXPECT_THROW(interpolator.interpolate(track.back().s + 1.0), std::runtime_error);
+
+    std::vector<th::Point2d> points = {th::Point2d(0.0, 0.0), th::Point2d(1.0, 0.0)};
+    EXPECT_THROW(th::TrackInterpolator2d{th::Track2d(points)}, std::runtime_error);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+
+namespace {
+size_t allocation_count = 0;
+}  // namespace
+
+// Count every heap allocation made by the test program
+void* operator new(std::size_t size) {
+    ++allocation_count;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+namespace {
+
+th::Track2d make_circle(size_t n, double radius) {
+    std::vector<th::Point2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2 * M_PI * i / n;
+        points.emplace_back(radius * std::cos(phi), radius * std::sin(phi));
+    }
+    th::Track2d track(points);
+    track.calculate(true);
+    return track;
+}
+
+}  // namespace
+
+TEST(Track2OutputBufferTest, InterpolateMatchesReturningOverload) {
+    th::Track2d track = make_circle(100, 10.0);
+    std::vector<double> s_query = {0.5, 3.0, 35.5, 70.0, -0.5};
+
+    std::vector<th::TrackPoint2d> expected = track.interpolate(s_query, true);
+    std::vector<th::TrackPoint2d> out;
+    track.interpolate(s_query, out, true);
+
+    ASSERT_EQ(out.size(), expected.size());
+    for (size_t i = 0; i < out.size(); ++i) {
+        EXPECT_EQ(out[i].s, expected[i].s);
+        EXPECT_EQ(out[i].x, expected[i].x);
+        EXPECT_EQ(out[i].y, expected[i].y);
+        EXPECT_EQ(out[i].psi, expected[i].psi);
+    }
+
+    th::Track2d expected_track = track.interpolate_track(0.5, true);
+    th::Track2d out_track;
+    track.interpolate_track(0.5, out_track, true);
+    ASSERT_EQ(out_track.size(), expected_track.size());
+    for (size_t i = 0; i < out_track.size(); ++i) {
+        EXPECT_EQ(out_track[i].s, expected_track[i].s);
+        EXPECT_EQ(out_track[i].kappa, expected_track[i].kappa);
+    }
+}
+
+TEST(Track2OutputBufferTest, SteadyStateDoesNotAllocate) {
+    th::Track2d track = make_circle(1000, 50.0);
+
+    std::vector<double> s_query(200);
+    for (size_t i = 0; i < s_query.size(); ++i) {
+        s_query[i] = 1.5 * i;
+    }
+    std::vector<th::TrackPoint2d> out;
+    std::vector<double> column(track.size());
+    th::Track2d out_track;
+
+    // Warm-up tick sizes the buffers
+    track.interpolate(s_query, out, true);
+    track.interpolate_track(0.5, out_track, true);
+
+    size_t allocations_before = allocation_count;
+    for (int tick = 0; tick < 100; ++tick) {
+        track.calculate(true);
+        track.interpolate(s_query, out, true);
+        track.interpolate(s_query.begin(), s_query.end(), out.begin(), true);
+        track.interpolate_track(0.5, out_track, true);
+        track.project(th::Point2d(50.0, 1.0), true);
+        track.s(column.begin());
+        track.kappa(column.begin());
+    }
+    EXPECT_EQ(allocation_count, allocations_before);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track.hpp>
+#include <cmath>
+#include <memory_resource>
+
+namespace {
+
+// Memory resource counting the allocations forwarded to its upstream
+class CountingResource : public std::pmr::memory_resource {
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream) : upstream_(upstream) {}
+
+    size_t allocations = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        ++allocations;
+        return upstream_->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        upstream_->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource* upstream_;
+};
+
+std::vector<th::Point2d> make_circle(size_t n, double radius) {
+    std::vector<th::Point2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2 * M_PI * i / n;
+        points.emplace_back(radius * std::cos(phi), radius * std::sin(phi));
+    }
+    return points;
+}
+
+}  // namespace
+
+TEST(Track2PmrTest, MatchesDefaultAllocator) {
+    std::vector<th::Point2d> points = make_circle(100, 10.0);
+    th::Track2d track(points);
+    track.calculate(true);
+
+    std::pmr::monotonic_buffer_resource arena;
+    th::pmr::Track2d pmr_track(points, &arena);
+    pmr_track.calculate(true);
+
+    ASSERT_EQ(pmr_track.size(), track.size());
+    for (size_t i = 0; i < track.size(); ++i) {
+        EXPECT_EQ(pmr_track[i].s, track[i].s);
+        EXPECT_EQ(pmr_track[i].psi, track[i].psi);
+        EXPECT_EQ(pmr_track[i].kappa, track[i].kappa);
+    }
+    EXPECT_EQ(th::find_nearest_idx(pmr_track, th::Point2d(10.0, 0.1)), 0);
+}
+
+TEST(Track2PmrTest, TemporariesUseTrackAllocator) {
+    std::vector<th::Point2d> points = make_circle(100, 10.0);
+
+    std::pmr::monotonic_buffer_resource arena;
+    CountingResource counting(&arena);
+    th::pmr::Track2d track(points, &counting);
+    track.calculate(true);
+    size_t allocations_before = counting.allocations;
+
+    th::pmr::Track2d::column_type s = track.s();
+    th::pmr::Track2d::point_vector_type interpolated = track.interpolate(std::vector<double>{0.5, 10.0, 70.0}, true);
+    th::pmr::Track2d resampled = track.interpolate_track(0.5, true);
+
+    EXPECT_EQ(counting.allocations, allocations_before + 3);
+    EXPECT_EQ(s.get_allocator().resource(), &counting);
+    EXPECT_EQ(interpolated.get_allocator().resource(), &counting);
+    EXPECT_EQ(resampled.get_allocator().resource(), &counting);
+    EXPECT_TRUE(resampled.has_kappa());
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
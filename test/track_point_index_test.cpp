@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track_point_index.hpp>
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace {
+
+th::Track2d make_track(size_t n) {
+    std::vector<th::Point2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        points.emplace_back(50.0 * std::cos(phi) + 10.0 * std::cos(3.0 * phi), 30.0 * std::sin(phi));
+    }
+    return th::Track2d(points);
+}
+
+std::vector<th::Point2d> random_points(size_t n, double extent, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(-extent, extent);
+    std::vector<th::Point2d> points;
+    for (size_t i = 0; i < n; ++i) points.emplace_back(dist(rng), dist(rng));
+    return points;
+}
+
+}  // namespace
+
+TEST(TrackPointIndexTest, BruteForceKNearest) {
+    std::vector<th::Point2d> points = {th::Point2d(0.0, 0.0), th::Point2d(3.0, 0.0), th::Point2d(1.0, 0.0), th::Point2d(-1.0, 0.0)};
+    th::Track2d track(points);
+
+    EXPECT_EQ(th::find_k_nearest_idx(track, th::Point2d(0.9, 0.0), 2), (std::vector<size_t>{2, 0}));
+    EXPECT_EQ(th::find_k_nearest_idx(track, th::Point2d(0.0, 0.0), 3), (std::vector<size_t>{0, 2, 3}));  // Tie by index
+    EXPECT_EQ(th::find_k_nearest_idx(track, th::Point2d(0.0, 0.0), 10).size(), 4);
+    EXPECT_TRUE(th::find_k_nearest_idx(track, th::Point2d(0.0, 0.0), 0).empty());
+    EXPECT_EQ(th::find_within_radius_idx(track, th::Point2d(0.0, 0.0), 1.0), (std::vector<size_t>{0, 2, 3}));
+    EXPECT_EQ(th::find_k_nearest_idx(track, th::Point2d(2.6, 0.0), 1).front(), th::find_nearest_idx(track, th::Point2d(2.6, 0.0)));
+}
+
+TEST(TrackPointIndexTest, KNearestMatchesBruteForce) {
+    th::Track2d track = make_track(1000);
+    th::TrackPointIndex2d index(track);
+    for (const auto& point : random_points(500, 80.0, 1)) {
+        for (size_t k : {1, 5, 32}) {
+            EXPECT_EQ(index.k_nearest(point, k), th::find_k_nearest_idx(track, point, k));
+        }
+    }
+    EXPECT_EQ(index.k_nearest(th::Point2d(0.0, 0.0), 2000).size(), track.size());
+}
+
+TEST(TrackPointIndexTest, FarQueriesMatchBruteForce) {
+    th::Track2d track = make_track(1000);
+    th::TrackPointIndex2d index(track);
+    for (double extent : {1e4, 1e7}) {
+        for (const auto& point : random_points(100, extent, 3)) {
+            EXPECT_EQ(index.k_nearest(point, 5), th::find_k_nearest_idx(track, point, 5));
+        }
+    }
+}
+
+TEST(TrackPointIndexTest, RadiusMatchesBruteForce) {
+    th::Track2d track = make_track(1000);
+    th::TrackPointIndex2d index(track, 3.0);
+    for (const auto& point : random_points(500, 80.0, 2)) {
+        for (double radius : {0.5, 4.0, 20.0}) {
+            EXPECT_EQ(index.within_radius(point, radius), th::find_within_radius_idx(track, point, radius));
+        }
+    }
+}
+
+TEST(TrackPointIndexTest, BatchQueries) {
+    th::Track2d track = make_track(500);
+    th::TrackPointIndex2d index(track);
+    std::vector<th::Point2d> queries = random_points(50, 60.0, 3);
+
+    std::vector<size_t> nearest(queries.size() * 4);
+    index.k_nearest(queries.begin(), queries.end(), 4, nearest.begin());
+    std::vector<size_t> indices;
+    std::vector<size_t> offsets;
+    index.within_radius(queries.begin(), queries.end(), 10.0, indices, offsets);
+    ASSERT_EQ(offsets.size(), queries.size() + 1);
+
+    for (size_t q = 0; q < queries.size(); ++q) {
+        std::vector<size_t> expected = th::find_k_nearest_idx(track, queries[q], 4);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(), nearest.begin() + q * 4));
+        std::vector<size_t> in_radius(indices.begin() + offsets[q], indices.begin() + offsets[q + 1]);
+        EXPECT_EQ(in_radius, th::find_within_radius_idx(track, queries[q], 10.0));
+    }
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track_progress.hpp>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+th::Track2d make_circle(double radius, size_t n) {
+    std::vector<th::TrackPoint2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        points.emplace_back(radius * std::cos(phi), radius * std::sin(phi));
+    }
+    th::Track2d track(points);
+    track.calculate(true);
+    return track;
+}
+
+th::Point2d on_circle(double radius, double phi) {
+    return th::Point2d(radius * std::cos(phi), radius * std::sin(phi));
+}
+
+}  // namespace
+
+TEST(ProgressTrackerTest, ContinuousOverLaps) {
+    th::Track2d track = make_circle(10.0, 200);
+    th::ProgressTracker2d tracker(track);
+    const double length = tracker.length();
+
+    double prev = -1.0;
+    for (double phi = 0.1; phi < 3.0 * 2.0 * M_PI; phi += 0.05) {
+        double s = tracker.update(on_circle(10.3, phi));
+        EXPECT_GT(s, prev);
+        EXPECT_NEAR(s, phi / (2.0 * M_PI) * length, 0.05);
+        EXPECT_GE(tracker.lap_s(), 0.0);
+        EXPECT_LT(tracker.lap_s(), length);
+        prev = s;
+    }
+    EXPECT_EQ(tracker.lap(), 2);
+}
+
+TEST(ProgressTrackerTest, BackwardsAcrossStart) {
+    th::Track2d track = make_circle(10.0, 200);
+    th::ProgressTracker2d tracker(track);
+
+    tracker.update(on_circle(10.0, 0.2));
+    EXPECT_EQ(tracker.lap(), 0);
+    tracker.update(on_circle(10.0, 0.1));
+    tracker.update(on_circle(10.0, -0.1));
+    EXPECT_EQ(tracker.lap(), -1);
+    EXPECT_NEAR(tracker.s(), -1.0, 0.01);
+    EXPECT_NEAR(tracker.lap_s(), tracker.length() - 1.0, 0.01);
+}
+
+TEST(ProgressTrackerTest, JumpIsFollowed) {
+    th::Track2d track = make_circle(10.0, 200);
+    th::ProgressTracker2d tracker(track, 4);
+
+    tracker.update(on_circle(10.0, 0.5));
+    tracker.update(on_circle(10.0, 2.0));
+    EXPECT_NEAR(tracker.s(), 20.0, 0.01);
+    EXPECT_NEAR(tracker.s_diff_to(5.0), 15.0, 0.01);
+}
+
+TEST(ProgressTrackerTest, ResetStartsOver) {
+    th::Track2d track = make_circle(10.0, 200);
+    th::ProgressTracker2d tracker(track);
+    for (double phi = 0.0; phi < 7.0; phi += 0.1) tracker.update(on_circle(10.0, phi));
+    EXPECT_EQ(tracker.lap(), 1);
+
+    tracker.reset();
+    EXPECT_FALSE(tracker.initialized());
+    tracker.update(on_circle(10.0, 1.0));
+    EXPECT_EQ(tracker.lap(), 0);
+    EXPECT_NEAR(tracker.s(), 10.0, 0.01);
+}
+
+TEST(ProgressTrackerTest, MissingSThrows) {
+    std::vector<th::TrackPoint2d> points = {th::TrackPoint2d(0.0, 0.0), th::TrackPoint2d(1.0, 0.0)};
+    th::Track2d track(points);
+    EXPECT_THROW(th::ProgressTracker2d tracker(track), std::runtime_error);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,152 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track_projector.hpp>
+#include <cmath>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Closed figure-eight-like curve with varying curvature
+th::Track2d make_track(size_t n) {
+    std::vector<th::Point2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2.0 * M_PI * static_cast<double>(i) / static_cast<double>(n);
+        points.emplace_back(50.0 * std::cos(phi) + 10.0 * std::cos(3.0 * phi), 30.0 * std::sin(phi));
+    }
+    th::Track2d track(points);
+    track.calculate(true);
+    return track;
+}
+
+void expect_same(const th::TrackPoint2d& a, const th::TrackPoint2d& b) {
+    EXPECT_EQ(a.x, b.x);
+    EXPECT_EQ(a.y, b.y);
+    EXPECT_EQ(a.s, b.s);
+    EXPECT_EQ(a.psi, b.psi);
+}
+
+std::vector<th::Point2d> random_points(size_t n, double extent, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> dist(-extent, extent);
+    std::vector<th::Point2d> points;
+    for (size_t i = 0; i < n; ++i) points.emplace_back(dist(rng), dist(rng));
+    return points;
+}
+
+}  // namespace
+
+TEST(TrackProjectorTest, MatchesProjectClosed) {
+    th::Track2d track = make_track(500);
+    th::TrackProjector2d projector(track, true);
+    for (const auto& point : random_points(2000, 100.0, 1)) {
+        expect_same(projector.project(point), track.project(point, true));
+    }
+}
+
+TEST(TrackProjectorTest, MatchesProjectOpen) {
+    th::Track2d track = make_track(300);
+    track.resize(200);
+    track.calculate(false);
+    th::TrackProjector2d projector(track, false, 2.0);
+    for (const auto& point : random_points(2000, 100.0, 2)) {
+        expect_same(projector.project(point), track.project(point, false));
+    }
+}
+
+TEST(TrackProjectorTest, FarQueries) {
+    th::Track2d track = make_track(500);
+    th::TrackProjector2d projector(track, true);
+    for (double extent : {1e4, 1e7}) {
+        for (const auto& point : random_points(200, extent, 7)) {
+            expect_same(projector.project(point), track.project(point, true));
+        }
+    }
+}
+
+TEST(TrackProjectorTest, TiesGoToLowerSegment) {
+    th::Track2d track = make_track(100);
+    th::TrackProjector2d projector(track, true);
+    for (size_t i = 0; i < track.size(); ++i) {
+        expect_same(projector.project(track[i].to_point()), track.project(track[i].to_point(), true));
+    }
+}
+
+TEST(TrackProjectorTest, StreamingAndBatchMatchScalar) {
+    th::Track2d track = make_track(500);
+    th::TrackProjector2d projector(track, true);
+
+    std::vector<th::Point2d> path;
+    for (double phi = 0.0; phi < 4.0 * M_PI; phi += 0.01) {
+        path.emplace_back(48.0 * std::cos(phi) + 10.0 * std::cos(3.0 * phi), 31.0 * std::sin(phi));
+    }
+    path.emplace_back(0.0, 0.0);  // Jump
+
+    th::TrackProjector2d::Context ctx;
+    std::vector<th::TrackPoint2d> batch(path.size());
+    projector.project(path.begin(), path.end(), batch.begin());
+    for (size_t i = 0; i < path.size(); ++i) {
+        th::TrackPoint2d expected = track.project(path[i], true);
+        expect_same(projector.project(path[i], ctx), expected);
+        expect_same(batch[i], expected);
+    }
+    EXPECT_TRUE(ctx.valid);
+}
+
+TEST(TrackProjectorTest, SharedAcrossThreads) {
+    th::Track2d track = make_track(500);
+    const th::TrackProjector2d projector(track, true);
+    std::vector<th::Point2d> points = random_points(400, 80.0, 3);
+
+    std::vector<std::vector<th::TrackPoint2d>> results(4, std::vector<th::TrackPoint2d>(points.size()));
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < results.size(); ++t) {
+        threads.emplace_back([&, t] {
+            th::TrackProjector2d::Context ctx;
+            for (size_t i = 0; i < points.size(); ++i) results[t][i] = projector.project(points[i], ctx);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+
+    for (size_t i = 0; i < points.size(); ++i) {
+        th::TrackPoint2d expected = track.project(points[i], true);
+        for (const auto& result : results) expect_same(result[i], expected);
+    }
+}
+
+TEST(TrackProjectorTest, GridIndex) {
+    th::GridIndex2d grid(1.0);
+    EXPECT_TRUE(grid.empty());
+    grid.insert(0, th::Point2d(0.5, 0.5));
+    grid.insert(1, th::Point2d(-0.5, 2.5));
+    grid.insert(2, th::Point2d(0.0, 0.0), th::Point2d(2.5, 0.5));
+
+    std::vector<size_t> ids;
+    grid.for_each_in_ring(0, 0, 0, [&](size_t id) { ids.push_back(id); });
+    EXPECT_EQ(ids, (std::vector<size_t>{0, 2}));
+    ids.clear();
+    grid.for_each_in_ring(0, 0, 2, [&](size_t id) { ids.push_back(id); });
+    EXPECT_EQ(ids, (std::vector<size_t>{1, 2}));
+    ids.clear();
+    grid.for_each_in_box(th::Point2d(1.2, 0.0), th::Point2d(3.0, 1.0), [&](size_t id) { ids.push_back(id); });
+    EXPECT_EQ(ids, (std::vector<size_t>{2, 2}));
+    EXPECT_EQ(grid.max_ring(0, 0), 2);
+    EXPECT_EQ(grid.min_ring(0, 0), 0);
+    EXPECT_EQ(grid.min_ring(100, 0), 98);
+    EXPECT_EQ(grid.ring_cells(0, 0, 1), 5);  // Clipped to x in [-1, 2], y in [0, 2]
+
+    // The walk stops when done, or gives up before looking up more cells than are occupied
+    auto collect = [&](size_t id) { ids.push_back(id); };
+    ids.clear();
+    EXPECT_TRUE(grid.for_each_ring(0, 0, collect, [](std::int64_t) { return true; }));
+    EXPECT_EQ(ids, (std::vector<size_t>{0, 2}));
+    ids.clear();
+    EXPECT_FALSE(grid.for_each_ring(100, 0, collect, [](std::int64_t) { return false; }));
+    EXPECT_EQ(ids, (std::vector<size_t>{2}));
+    EXPECT_THROW(th::GridIndex2d(0.0), std::runtime_error);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
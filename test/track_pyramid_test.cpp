@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track_pyramid.hpp>
+#include <cmath>
+#include <random>
+
+namespace {
+
+th::Track2d make_ellipse(size_t n, double a, double b) {
+    std::vector<th::Point2d> points;
+    for (size_t i = 0; i < n; ++i) {
+        double phi = 2 * M_PI * i / n;
+        points.emplace_back(a * std::cos(phi), b * std::sin(phi));
+    }
+    th::Track2d track(points);
+    track.calculate(true);
+    return track;
+}
+
+}  // namespace
+
+TEST(TrackPyramid2Test, Levels) {
+    th::Track2d track = make_ellipse(10000, 500.0, 300.0);
+    th::TrackPyramid2d pyramid(track, 4, 64);
+
+    EXPECT_EQ(pyramid.level_size(0), 10000);
+    EXPECT_EQ(pyramid.level_size(1), 2500);
+    EXPECT_EQ(pyramid.level_size(2), 625);
+    EXPECT_EQ(pyramid.level_size(3), 157);
+    EXPECT_EQ(pyramid.num_levels(), 4);
+
+    auto range = pyramid.index_range(2, 3);
+    EXPECT_EQ(range.first, 48);
+    EXPECT_EQ(range.second, 64);
+}
+
+TEST(TrackPyramid2Test, ShortTrackFallsBackToFullSearch) {
+    th::Track2d track = make_ellipse(20, 5.0, 3.0);
+    th::TrackPyramid2d pyramid(track);
+    EXPECT_EQ(pyramid.num_levels(), 1);
+
+    th::Point2d point(5.2, 0.1);
+    EXPECT_EQ(pyramid.find_nearest_idx(point), th::find_nearest_idx(track, point));
+}
+
+TEST(TrackPyramid2Test, MatchesFullSearch) {
+    th::Track2d track = make_ellipse(10000, 500.0, 300.0);
+    th::TrackPyramid2d pyramid(track);
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> phi_dist(0.0, 2 * M_PI);
+    std::uniform_real_distribution<double> offset_dist(-20.0, 20.0);
+
+    for (int i = 0; i < 200; ++i) {
+        double phi = phi_dist(rng);
+        double offset = offset_dist(rng);
+        th::Point2d point((500.0 + offset) * std::cos(phi), (300.0 + offset) * std::sin(phi));
+
+        EXPECT_EQ(pyramid.find_nearest_idx(point), th::find_nearest_idx(track, point));
+
+        th::TrackPoint2d expected = track.project(point, true);
+        th::TrackPoint2d projected = pyramid.project(point, true);
+        EXPECT_NEAR(projected.x, expected.x, 1e-9);
+        EXPECT_NEAR(projected.y, expected.y, 1e-9);
+        EXPECT_NEAR(projected.s, expected.s, 1e-9);
+    }
+}
+
+TEST(TrackPyramid2Test, WarmStartedProjection) {
+    th::Track2d track = make_ellipse(1000, 50.0, 30.0);
+
+    th::Point2d point(50.5, 0.2);
+    th::TrackPoint2d expected = track.project(point, true);
+    th::TrackPoint2d projected = track.project(point, 999, 3, true);
+    EXPECT_NEAR(projected.x, expected.x, 1e-12);
+    EXPECT_NEAR(projected.y, expected.y, 1e-12);
+    EXPECT_NEAR(projected.s, expected.s, 1e-12);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
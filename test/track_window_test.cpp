@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/track/track_window.hpp>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+th::Track2d make_square() {
+    std::vector<th::TrackPoint2d> points = {
+        th::TrackPoint2d(0.0, 0.0),
+        th::TrackPoint2d(1.0, 0.0),
+        th::TrackPoint2d(1.0, 1.0),
+        th::TrackPoint2d(0.0, 1.0)
+    };
+    th::Track2d track(points);
+    track.calculate(true);
+    return track;
+}
+
+}  // namespace
+
+TEST(TrackWindowTest, WindowWithoutWrap) {
+    th::Track2d track = make_square();
+    th::TrackWindow2<double> window = th::horizon_window(track, 0.5, 1.2, true);
+
+    EXPECT_FALSE(window.wraps());
+    ASSERT_EQ(window.size(), 3);
+    EXPECT_EQ(window.first, track.data());
+    EXPECT_EQ(window[0].s, 0.0);
+    EXPECT_EQ(window[2].s, 2.0);
+}
+
+TEST(TrackWindowTest, WindowAcrossSeam) {
+    th::Track2d track = make_square();
+    th::TrackWindow2<double> window = th::horizon_window(track, 3.5, 1.2, true);
+
+    EXPECT_TRUE(window.wraps());
+    ASSERT_EQ(window.size(), 3);
+    EXPECT_EQ(window[0].s, 3.0);
+    EXPECT_EQ(window[1].s, 4.0);  // front of the track one lap later
+    EXPECT_EQ(window[2].s, 5.0);
+    EXPECT_EQ(window[2].x, 1.0);
+}
+
+TEST(TrackWindowTest, WindowOpenTrackIsClamped) {
+    th::Track2d track = make_square();
+    th::TrackWindow2<double> window = th::horizon_window(track, 2.5, 5.0, false);
+
+    EXPECT_FALSE(window.wraps());
+    ASSERT_EQ(window.size(), 2);
+    EXPECT_EQ(window[1].s, 3.0);
+}
+
+TEST(TrackWindowTest, ResampleMatchesInterpolate) {
+    th::Track2d track = make_square();
+    std::vector<th::TrackPoint2d> buffer(11);
+    auto end = th::resample_window(track, 3.25, 5.0, 0.5, buffer.begin(), true);
+    EXPECT_EQ(end, buffer.end());
+
+    for (size_t k = 0; k < buffer.size(); ++k) {
+        double s = 3.25 + 0.5 * k;
+        th::TrackPoint2d expected = track.interpolate(s, true);
+        EXPECT_NEAR(buffer[k].s, s, 1e-12);
+        EXPECT_NEAR(buffer[k].x, expected.x, 1e-12);
+        EXPECT_NEAR(buffer[k].y, expected.y, 1e-12);
+    }
+}
+
+TEST(TrackWindowTest, ResampleOpenTrackRepeatsEnd) {
+    th::Track2d track = make_square();
+    std::vector<th::TrackPoint2d> buffer(5);
+    th::resample_window(track, 2.0, 2.0, 0.5, buffer.begin(), false);
+
+    EXPECT_NEAR(buffer[1].x, 0.5, 1e-12);
+    EXPECT_NEAR(buffer[1].y, 1.0, 1e-12);
+    EXPECT_EQ(buffer[2].s, 3.0);
+    EXPECT_EQ(buffer[4].s, 3.0);
+    EXPECT_THROW(th::resample_window(track, 3.5, 1.0, 0.5, buffer.begin(), false), std::runtime_error);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/trajectory/trajectory.hpp>
+#include <cmath>
+
+namespace {
+
+th::Track2d make_line() {
+    std::vector<th::Point2d> points = {
+        th::Point2d(0.0, 0.0),
+        th::Point2d(10.0, 0.0),
+        th::Point2d(20.0, 0.0),
+        th::Point2d(30.0, 0.0)
+    };
+    th::Track2d track(points);
+    track.calculate(false);
+    return track;
+}
+
+}  // namespace
+
+TEST(Trajectory2Test, FromTrackAndVelocityProfile) {
+    th::Track2d track = make_line();
+    th::Trajectory2d trajectory(track, {10.0, 10.0, 20.0, 20.0}, false);
+
+    ASSERT_EQ(trajectory.size(), 4);
+    EXPECT_NEAR(trajectory[1].t, 1.0, 1e-12);
+    EXPECT_NEAR(trajectory[2].t, 1.0 + 2 * 10.0 / 30.0, 1e-12);
+    EXPECT_NEAR(trajectory.duration(), 1.0 + 2 * 10.0 / 30.0 + 0.5, 1e-12);
+    EXPECT_NEAR(trajectory[0].a, 0.0, 1e-12);
+    EXPECT_NEAR(trajectory[1].a, (400.0 - 100.0) / 20.0, 1e-12);
+}
+
+TEST(Trajectory2Test, ClosedTrackCoversFullLap) {
+    std::vector<th::TrackPoint2d> points = {
+        th::TrackPoint2d(0.0, 0.0),
+        th::TrackPoint2d(1.0, 0.0),
+        th::TrackPoint2d(1.0, 1.0),
+        th::TrackPoint2d(0.0, 1.0)
+    };
+    th::Track2d track(points);
+    track.calculate(true);
+    th::Trajectory2d trajectory(track, {2.0, 2.0, 2.0, 2.0}, true);
+
+    ASSERT_EQ(trajectory.size(), 5);
+    EXPECT_NEAR(trajectory.back().s, 4.0, 1e-12);
+    EXPECT_NEAR(trajectory.duration(), 2.0, 1e-12);
+    th::TrajectoryPoint2d sampled = trajectory.sample(1.75);
+    EXPECT_NEAR(sampled.x, 0.0, 1e-12);
+    EXPECT_NEAR(sampled.y, 0.5, 1e-12);
+}
+
+TEST(Trajectory2Test, SampleWithConstantAcceleration) {
+    th::Track2d track = make_line();
+    th::Trajectory2d trajectory(track, {10.0, 10.0, 20.0, 20.0}, false);
+
+    // Second segment accelerates from 10 to 20 m/s over 10 m
+    double a = 15.0;
+    double tau = 0.3;
+    th::TrajectoryPoint2d sampled = trajectory.sample(1.0 + tau);
+    EXPECT_NEAR(sampled.v, 10.0 + a * tau, 1e-12);
+    EXPECT_NEAR(sampled.s, 10.0 + 10.0 * tau + 0.5 * a * tau * tau, 1e-12);
+    EXPECT_NEAR(sampled.x, sampled.s, 1e-12);
+
+    EXPECT_THROW(trajectory.sample(-0.1), std::runtime_error);
+    EXPECT_THROW(trajectory.sample(trajectory.duration() + 0.1), std::runtime_error);
+}
+
+TEST(Trajectory2Test, SamplerMatchesBinarySearch) {
+    th::Track2d track = make_line();
+    th::Trajectory2d trajectory(track, {5.0, 10.0, 20.0, 15.0}, false);
+    th::TrajectorySampler2d sampler(trajectory);
+
+    for (double t = 0.0; t <= trajectory.duration(); t += 0.01) {
+        th::TrajectoryPoint2d streamed = sampler.sample(t);
+        th::TrajectoryPoint2d expected = trajectory.sample(t);
+        EXPECT_NEAR(streamed.s, expected.s, 1e-12);
+        EXPECT_NEAR(streamed.v, expected.v, 1e-12);
+    }
+    EXPECT_EQ(sampler.segment(), 2);
+
+    // Going back in time still works
+    EXPECT_NEAR(sampler.sample(0.0).s, 0.0, 1e-12);
+    EXPECT_EQ(sampler.segment(), 0);
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
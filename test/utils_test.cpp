@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <trajectory_helper/utils.hpp>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+// The loop based normalization normalize_psi used to implement
+double normalize_psi_loop(double psi) {
+    while (psi > M_PI) psi -= 2 * M_PI;
+    while (psi <= -M_PI) psi += 2 * M_PI;
+    return psi;
+}
+
+// The truncation and select based normalization normalize_psi used to implement
+template<typename T>
+T normalize_psi_select(T psi) {
+    const T two_pi = T(2 * M_PI);
+    T wrapped = psi - two_pi * std::trunc(psi / two_pi);
+    wrapped = wrapped > T(M_PI) ? wrapped - two_pi : wrapped;
+    return wrapped <= T(-M_PI) ? wrapped + two_pi : wrapped;
+}
+
+template<typename T>
+void expect_wrap_psi_matches(T psi) {
+    EXPECT_EQ(th::wrap_psi(psi), normalize_psi_select(psi)) << psi;
+    EXPECT_EQ(th::normalize_psi(psi), normalize_psi_select(psi)) << psi;
+    EXPECT_EQ(std::signbit(th::wrap_psi(psi)), std::signbit(normalize_psi_select(psi))) << psi;
+}
+
+}  // namespace
+
+TEST(UtilsTest, NormalizePsiRange) {
+    EXPECT_EQ(th::normalize_psi(M_PI), M_PI);
+    EXPECT_EQ(th::normalize_psi(-M_PI), M_PI);
+    EXPECT_EQ(th::normalize_psi(0.0), 0.0);
+    EXPECT_EQ(th::normalize_psi(1.0), 1.0);
+    EXPECT_EQ(th::normalize_psi(-3.0), -3.0);
+    EXPECT_NEAR(th::normalize_psi(3 * M_PI), M_PI, 1e-12);
+    EXPECT_NEAR(th::normalize_psi(-3 * M_PI), M_PI, 1e-12);
+    EXPECT_NEAR(th::normalize_psi(2 * M_PI + 0.5), 0.5, 1e-12);
+    EXPECT_NEAR(th::normalize_psi(-2 * M_PI - 0.5), -0.5, 1e-12);
+    EXPECT_EQ(th::normalize_psi(4), 4 - 6);  // integer angles keep the loop semantics
+}
+
+TEST(UtilsTest, NormalizePsiMatchesLoop) {
+    for (int i = -10000; i <= 10000; ++i) {
+        double psi = i * 0.00731;
+        double normalized = th::normalize_psi(psi);
+        EXPECT_GT(normalized, -M_PI);
+        EXPECT_LE(normalized, M_PI);
+        EXPECT_NEAR(std::remainder(normalized - normalize_psi_loop(psi), 2 * M_PI), 0.0, 1e-12);
+
+        float normalized_f = th::normalize_psi(float(psi));
+        EXPECT_GT(normalized_f, -float(M_PI));
+        EXPECT_LE(normalized_f, float(M_PI));
+    }
+}
+
+TEST(UtilsTest, WrapPsiMatchesSelects) {
+    for (int i = -29999; i <= 30000; ++i) {  // (-3 pi, 3 pi]
+        double psi = i * (3 * M_PI / 30000);
+        expect_wrap_psi_matches(psi);
+        expect_wrap_psi_matches(float(psi));
+    }
+    for (double psi : {M_PI, -M_PI, 2 * M_PI, -2 * M_PI, std::nextafter(2 * M_PI, 0.0), std::nextafter(-2 * M_PI, 0.0),
+                       std::nextafter(M_PI, 4.0), std::nextafter(-M_PI, -4.0), 0.0, -0.0}) {
+        expect_wrap_psi_matches(psi);
+        expect_wrap_psi_matches(float(psi));
+    }
+}
+
+TEST(UtilsTest, AngleDiff) {
+    EXPECT_NEAR(th::angle_diff(M_PI - 0.1, -M_PI + 0.1), -0.2, 1e-12);
+    EXPECT_NEAR(th::angle_diff(-M_PI + 0.1, M_PI - 0.1), 0.2, 1e-12);
+    EXPECT_NEAR(th::angle_diff(0.3, 0.1), 0.2, 1e-12);
+}
+
+TEST(UtilsTest, WrapS) {
+    EXPECT_EQ(th::wrap_s(3.0, 0.0, 10.0), 3.0);
+    EXPECT_NEAR(th::wrap_s(13.0, 0.0, 10.0), 3.0, 1e-12);
+    EXPECT_NEAR(th::wrap_s(-7.0, 0.0, 10.0), 3.0, 1e-12);
+    EXPECT_NEAR(th::wrap_s(10.0, 0.0, 10.0), 0.0, 1e-12);
+    EXPECT_NEAR(th::wrap_s(0.5, 1.0, 10.0), 10.5, 1e-12);
+    for (int i = -500; i <= 500; ++i) {
+        double s = 0.37 * i;
+        EXPECT_NEAR(th::wrap_s(s, 0.0, 7.0), std::fmod(std::fmod(s, 7.0) + 7.0, 7.0), 1e-9);
+    }
+}
+
+TEST(UtilsTest, WrapSBatchMatchesScalar) {
+    std::vector<float> s;
+    for (int i = -200; i <= 200; ++i) s.push_back(0.91f * static_cast<float>(i));
+    std::vector<float> wrapped(s.size());
+    th::wrap_s(s.begin(), s.end(), wrapped.begin(), 2.0f, 25.0f);
+    for (size_t i = 0; i < s.size(); ++i) {
+        EXPECT_NEAR(wrapped[i], th::wrap_s(s[i], 2.0f, 25.0f), 1e-4f);
+        EXPECT_GE(wrapped[i], 2.0f - 1e-4f);
+        EXPECT_LE(wrapped[i], 27.0f + 1e-4f);
+    }
+}
+
+TEST(UtilsTest, SDiffIsWrapSafe) {
+    EXPECT_NEAR(th::s_diff(1.0, 9.0, 10.0), 2.0, 1e-12);
+    EXPECT_NEAR(th::s_diff(9.0, 1.0, 10.0), -2.0, 1e-12);
+    EXPECT_NEAR(th::s_diff(4.0, 3.0, 10.0), 1.0, 1e-12);
+    EXPECT_NEAR(th::s_diff(23.0, 1.0, 10.0), 2.0, 1e-12);
+    EXPECT_NEAR(th::s_diff(6.0, 1.0, 10.0), -5.0, 1e-12);  // half a lap is negative
+}
+
+int main(int argc, char **argv) {
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}